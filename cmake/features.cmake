@@ -28,6 +28,9 @@ ie_dependent_option (ENABLE_ONEDNN_FOR_GPU "Enable oneDNN with GPU support" ON "
 
 ie_option (ENABLE_PROFILING_ITT "Build with ITT tracing. Optionally configure pre-built ittnotify library though INTEL_VTUNE_DIR variable." OFF)
 
+ie_option (ENABLE_PROFILING_TRACE "Build with built-in collector of ITT scopes which writes Chrome trace JSON. \
+Collection is enabled in runtime by OPENVINO_TRACE_FILE environment variable." OFF)
+
 ie_option_enum(ENABLE_PROFILING_FILTER "Enable or disable ITT counter groups.\
 Supported values:\
  ALL - enable all ITT counters (default value)\
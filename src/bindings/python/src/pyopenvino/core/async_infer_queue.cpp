@@ -9,9 +9,11 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstring>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -19,6 +21,75 @@
 
 namespace py = pybind11;
 
+namespace {
+ov::Tensor get_request_tensor(ov::InferRequest& request, const py::handle& key) {
+    if (py::isinstance<ov::Output<const ov::Node>>(key)) {
+        return request.get_tensor(key.cast<ov::Output<const ov::Node>>());
+    } else if (py::isinstance<py::str>(key)) {
+        return request.get_tensor(key.cast<std::string>());
+    } else if (py::isinstance<py::int_>(key)) {
+        return request.get_input_tensor(key.cast<size_t>());
+    }
+    throw py::type_error("Incompatible key type for input: " + std::string(py::str(key)));
+}
+
+// Copies numpy data directly into the tensor owned by request, no temporary Tensor is created.
+void copy_to_request_tensor(ov::Tensor tensor, py::array array) {
+    auto dtype = Common::ov_type_to_dtype().at(tensor.get_element_type());
+    // Up/down-cast data to the type of tensor like it is done in Python's update_tensor
+    if (!array.dtype().equal(dtype)) {
+        array = py::array::ensure(array.attr("astype")(dtype));
+    }
+    array = py::array::ensure(array, py::array::c_style);
+    ov::Shape shape(array.shape(), array.shape() + array.ndim());
+    if (tensor.get_shape() != shape) {
+        tensor.set_shape(shape);
+    }
+    py::buffer_info buf = array.request();
+    std::memcpy(tensor.data(), buf.ptr, buf.ndim == 0 ? buf.itemsize : buf.itemsize * buf.size);
+}
+
+void set_request_inputs(ov::InferRequest& request, const py::handle& key, const py::handle& value) {
+    if (py::isinstance<ov::Tensor>(value)) {
+        if (key.is_none()) {
+            request.set_input_tensor(Common::cast_to_tensor(value));
+        } else if (py::isinstance<py::int_>(key)) {
+            request.set_input_tensor(key.cast<size_t>(), Common::cast_to_tensor(value));
+        } else if (py::isinstance<py::str>(key)) {
+            request.set_tensor(key.cast<std::string>(), Common::cast_to_tensor(value));
+        } else {
+            request.set_tensor(key.cast<ov::Output<const ov::Node>>(), Common::cast_to_tensor(value));
+        }
+        return;
+    }
+    auto array = py::array::ensure(value);
+    if (!array) {
+        throw py::type_error("Incompatible input data of type " + std::string(py::str(value.get_type())) + "!");
+    }
+    copy_to_request_tensor(key.is_none() ? request.get_input_tensor() : get_request_tensor(request, key), array);
+}
+
+// Accepts the same kinds of inputs as a single start_async call: Tensor, numpy array (or array-like object),
+// dict with int/str/ConstOutput keys or list/tuple of per-input values.
+void set_request_inputs(ov::InferRequest& request, const py::handle& inputs) {
+    if (inputs.is_none()) {
+        return;
+    }
+    if (py::isinstance<py::dict>(inputs)) {
+        for (auto&& input : inputs.cast<py::dict>()) {
+            set_request_inputs(request, input.first, input.second);
+        }
+    } else if (py::isinstance<py::list>(inputs) || py::isinstance<py::tuple>(inputs)) {
+        size_t idx = 0;
+        for (auto&& input : inputs) {
+            set_request_inputs(request, py::int_(idx++), input);
+        }
+    } else {
+        set_request_inputs(request, py::none(), inputs);
+    }
+}
+}  // namespace
+
 class AsyncInferQueue {
 public:
     AsyncInferQueue(std::vector<InferRequestWrapper> requests,
@@ -31,6 +102,7 @@ public:
     }
 
     ~AsyncInferQueue() {
+        stop_batch_flusher();
         _requests.clear();
     }
 
@@ -68,13 +140,20 @@ public:
         for (auto&& request : _requests) {
             request._request.wait();
         }
-        // acquire the mutex to access _errors
-        std::lock_guard<std::mutex> lock(_mutex);
+        // acquire the mutex to access _errors and _finished_handles
+        std::unique_lock<std::mutex> lock(_mutex);
+        // requests waiting for the batch callback are flushed right away
+        _batch_deadline = BatchClock::now();
+        _batch_cv.notify_one();
+        _cv.wait(lock, [this] {
+            return _finished_handles.empty() && _flushing_batches == 0;
+        });
         if (_errors.size() > 0)
             throw _errors.front();
     }
 
     void set_default_callbacks() {
+        stop_batch_flusher();
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
@@ -97,7 +176,44 @@ public:
         }
     }
 
+    void start_async_many(const py::iterable& inputs, const py::object& userdata) {
+        // Each step holds the GIL only to unpack the next item from Python objects,
+        // waiting for an idle request and starting inference are done with GIL released.
+        auto userdata_it = userdata.is_none() ? py::iterator() : py::iter(userdata);
+        for (auto&& item : inputs) {
+            auto handle = get_idle_request_id();
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _idle_handles.pop();
+            }
+            if (userdata_it) {
+                OPENVINO_ASSERT(userdata_it != py::iterator::sentinel(), "Not enough userdata for given inputs!");
+                _user_ids[handle] = py::reinterpret_borrow<py::object>(*userdata_it);
+                ++userdata_it;
+            } else {
+                _user_ids[handle] = py::none();
+            }
+            try {
+                set_request_inputs(_requests[handle]._request, item);
+            } catch (...) {
+                // Give the request back to the pool, it was not started
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _idle_handles.push(handle);
+                }
+                _cv.notify_one();
+                throw;
+            }
+            {
+                py::gil_scoped_release release;
+                _requests[handle]._start_time = Time::now();
+                _requests[handle]._request.start_async();
+            }
+        }
+    }
+
     void set_custom_callbacks(py::function f_callback) {
+        stop_batch_flusher();
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
@@ -130,12 +246,139 @@ public:
         }
     }
 
+    void set_custom_batch_callbacks(py::function f_callback, size_t batch_size, size_t timeout_ms) {
+        OPENVINO_ASSERT(batch_size > 0, "Batch size of callback must be greater than zero!");
+        stop_batch_flusher();
+        _batch_callback = f_callback;
+        _batch_size = batch_size;
+        _batch_timeout = std::chrono::milliseconds(timeout_ms);
+        _stop_flusher = false;
+        _batch_flusher = std::thread([this] {
+            flush_batches_on_timeout();
+        });
+        for (size_t handle = 0; handle < _requests.size(); handle++) {
+            _requests[handle]._request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                _requests[handle]._end_time = Time::now();
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    throw ov::Exception(e.what());
+                }
+                std::vector<size_t> finished;
+                {
+                    // acquire the mutex to access _finished_handles
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (_finished_handles.empty()) {
+                        _batch_deadline = BatchClock::now() + _batch_timeout;
+                        _batch_cv.notify_one();
+                    }
+                    _finished_handles.push_back(handle);
+                    // Full batch is flushed by the request which completed it,
+                    // incomplete one is flushed by the flusher thread after the timeout.
+                    if (_finished_handles.size() >= _batch_size) {
+                        finished.swap(_finished_handles);
+                        _flushing_batches++;
+                    }
+                }
+                if (!finished.empty()) {
+                    flush_batch(finished);
+                }
+            });
+        }
+    }
+
+    // Calls batch callback for the given requests and returns them to the pool,
+    // the caller increments _flushing_batches when it takes requests from _finished_handles.
+    void flush_batch(const std::vector<size_t>& finished) {
+        {
+            // Acquire GIL, execute Python function once for the whole batch
+            py::gil_scoped_acquire acquire;
+            try {
+                py::list requests;
+                py::list userdata;
+                for (auto&& finished_handle : finished) {
+                    requests.append(py::cast(_requests[finished_handle]));
+                    userdata.append(_user_ids[finished_handle]);
+                }
+                _batch_callback(requests, userdata);
+            } catch (py::error_already_set py_error) {
+                assert(PyErr_Occurred());
+                // acquire the mutex to access _errors
+                std::lock_guard<std::mutex> lock(_mutex);
+                _errors.push(py_error);
+            }
+        }
+        {
+            // acquire the mutex to access _idle_handles
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto&& finished_handle : finished) {
+                _idle_handles.push(finished_handle);
+            }
+            _flushing_batches--;
+        }
+        // Notify locks in getIdleRequestId() and wait_all()
+        _cv.notify_all();
+    }
+
+    // Body of the flusher thread, it flushes an incomplete batch once the oldest request in it
+    // has waited for the timeout, so finished requests don't wait for the rest of the pool.
+    void flush_batches_on_timeout() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            if (_finished_handles.empty()) {
+                if (_stop_flusher) {
+                    break;
+                }
+                _batch_cv.wait(lock);
+                continue;
+            }
+            if (!_stop_flusher && BatchClock::now() < _batch_deadline) {
+                _batch_cv.wait_until(lock, _batch_deadline);
+                continue;
+            }
+            std::vector<size_t> finished;
+            finished.swap(_finished_handles);
+            _flushing_batches++;
+            lock.unlock();
+            flush_batch(finished);
+            lock.lock();
+        }
+    }
+
+    // Flushes requests waiting for the batch callback and stops the flusher thread.
+    void stop_batch_flusher() {
+        if (!_batch_flusher.joinable()) {
+            return;
+        }
+        // release GIL, the flusher may need it to call the callback
+        py::gil_scoped_release release;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop_flusher = true;
+        }
+        _batch_cv.notify_one();
+        _batch_flusher.join();
+    }
+
     std::vector<InferRequestWrapper> _requests;
     std::queue<size_t> _idle_handles;
+    std::vector<size_t> _finished_handles;  // requests waiting for the batch callback
     std::vector<py::object> _user_ids;  // user ID can be any Python object
     std::mutex _mutex;
     std::condition_variable _cv;
     std::queue<py::error_already_set> _errors;
+
+    using BatchClock = std::chrono::steady_clock;
+    py::function _batch_callback;
+    size_t _batch_size = 1;
+    std::chrono::milliseconds _batch_timeout{0};
+    BatchClock::time_point _batch_deadline;  // time to flush the oldest request in _finished_handles
+    size_t _flushing_batches = 0;            // batches taken from _finished_handles, which are not in the pool yet
+    bool _stop_flusher = false;
+    std::condition_variable _batch_cv;
+    std::thread _batch_flusher;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -261,6 +504,31 @@ void regclass_AsyncInferQueue(py::module m) {
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    cls.def("start_async_many",
+            &AsyncInferQueue::start_async_many,
+            py::arg("inputs"),
+            py::arg("userdata") = py::none(),
+            R"(
+            Run asynchronous inference for each item of `inputs` using available InferRequests.
+
+            The whole sequence is consumed in a single call, which saves
+            the overhead of calling start_async from Python for every item.
+            Each item is accepted in the same form as `inputs` of start_async:
+            Tensor, numpy.array, list/tuple of them or dict with int, str or
+            ConstOutput keys. Numpy data is copied straight into tensors of
+            the InferRequest which is going to run it.
+
+            GIL is released while waiting for the next available InferRequest
+            and while starting the inference.
+
+            :param inputs: Iterable with data for consecutive inferences.
+            :type inputs: Iterable[Any]
+            :param userdata: Optional iterable with data that will be passed to a callback,
+                             one item per inference.
+            :type userdata: Iterable[Any], optional
+            :rtype: None
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
@@ -313,6 +581,40 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batch_callback",
+            &AsyncInferQueue::set_custom_batch_callbacks,
+            py::arg("callback"),
+            py::arg("batch_size"),
+            py::arg("timeout") = 10,
+            R"(
+            Sets callback on all InferRequests from queue's pool, which is invoked
+            once per group of finished requests instead of once per request.
+            Signature of such function should have two arguments: list of
+            finished InferRequest objects and list of their userdata.
+
+            Callback is invoked when `batch_size` requests have finished or
+            when `timeout` milliseconds have passed since the first request
+            of the batch finished, whichever comes first. wait_all() flushes
+            the incomplete batch immediately. Requests return to the pool only
+            after the callback is done.
+
+            .. code-block:: python
+
+                def f(requests, userdata):
+                    for request, data in zip(requests, userdata):
+                        print(request.output_tensors[0].data, data)
+
+                async_infer_queue.set_batch_callback(f, 16)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+            :param batch_size: Maximum number of requests passed to a single callback call.
+            :type batch_size: int
+            :param timeout: Time in milliseconds a finished request may wait for the rest
+                            of its batch. Default: 10
+            :type timeout: int
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
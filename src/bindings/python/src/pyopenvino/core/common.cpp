@@ -310,10 +310,30 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::array array_from_tensor_shared(ov::Tensor& tensor) {
+    auto ov_type = tensor.get_element_type();
+    auto dtype = Common::ov_type_to_dtype().at(ov_type);
+    // Python object of the Tensor becomes a base of the array, it keeps
+    // underlying memory alive as long as the array (or any view of it) exists.
+    if (ov_type.bitwidth() < 8) {
+        return py::array(dtype, tensor.get_byte_size(), tensor.data(), py::cast(tensor));
+    }
+    return py::array(dtype, tensor.get_shape(), tensor.get_strides(), tensor.data(), py::cast(tensor));
+}
+
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        // No copy is performed, array is a view on the output tensor's memory.
+        // It is overwritten by the next inference run on the same request.
+        // Element types without numpy counterpart are copied as usual.
+        if (share_outputs && Common::ov_type_to_dtype().count(t.get_element_type())) {
+            res[py::cast(out)] = array_from_tensor_shared(t);
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
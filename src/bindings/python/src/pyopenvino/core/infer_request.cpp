@@ -18,14 +18,37 @@ PYBIND11_MAKE_OPAQUE(Containers::TensorNameMap);
 
 namespace py = pybind11;
 
-py::dict run_sync_infer(InferRequestWrapper& self) {
+py::dict run_sync_infer(InferRequestWrapper& self, bool share_outputs) {
     {
         py::gil_scoped_release release;
         self._start_time = Time::now();
         self._request.infer();
         self._end_time = Time::now();
     }
-    return Common::outputs_to_dict(self._outputs, self._request);
+    return Common::outputs_to_dict(self._outputs, self._request, share_outputs);
+}
+
+size_t get_output_index(InferRequestWrapper& self, const py::handle& key) {
+    if (py::isinstance<py::int_>(key)) {
+        auto idx = key.cast<size_t>();
+        OPENVINO_ASSERT(idx < self._outputs.size(), "Output index ", idx, " is out of range!");
+        return idx;
+    }
+    for (size_t idx = 0; idx < self._outputs.size(); ++idx) {
+        const auto& output = self._outputs[idx];
+        if (py::isinstance<py::str>(key)) {
+            if (output.get_names().count(key.cast<std::string>())) {
+                return idx;
+            }
+        } else if (py::isinstance<ov::Output<const ov::Node>>(key)) {
+            if (output == key.cast<ov::Output<const ov::Node>>()) {
+                return idx;
+            }
+        } else {
+            throw py::type_error("Incompatible key type for output buffer: " + std::string(key.get_type().str()));
+        }
+    }
+    throw ov::Exception("Output " + std::string(py::str(key)) + " is not found in the model outputs!");
 }
 
 void regclass_InferRequest(py::module m) {
@@ -115,6 +138,34 @@ void regclass_InferRequest(py::module m) {
             :type inputs: Dict[int, openvino.runtime.Tensor]
         )");
 
+    // Python API exclusive function
+    cls.def(
+        "set_output_buffers",
+        [](InferRequestWrapper& self, const py::dict& outputs) {
+            for (auto&& output : outputs) {
+                if (!py::isinstance<py::array>(output.second)) {
+                    throw py::type_error("Output buffer must be of numpy.array type!");
+                }
+                auto idx = get_output_index(self, output.first);
+                auto array = output.second.cast<py::array>();
+                self._request.set_output_tensor(idx, Common::tensor_from_numpy(array, true));
+                self.output_buffers[idx] = array;
+            }
+        },
+        py::arg("outputs"),
+        R"(
+            Binds user-provided numpy arrays as output tensors.
+            Plugin writes results directly into the memory of given arrays,
+            no copy is performed after the inference. Arrays are kept alive
+            by this InferRequest until they are replaced by other buffers.
+
+            Arrays must be C contiguous and match element type and shape
+            of the corresponding model outputs.
+
+            :param outputs: Arrays to bind as output tensors.
+            :type outputs: Dict[Union[int, str, openvino.runtime.ConstOutput], numpy.array]
+        )");
+
     // Python API exclusive function
     cls.def(
         "set_input_tensors",
@@ -171,11 +222,12 @@ void regclass_InferRequest(py::module m) {
     // Overload for single input, it will throw error if a model has more than one input.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const ov::Tensor& inputs) {
+        [](InferRequestWrapper& self, const ov::Tensor& inputs, bool share_outputs) {
             self._request.set_input_tensor(inputs);
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -185,6 +237,10 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on single input tensor.
             :type inputs: openvino.runtime.Tensor
+            :param share_outputs: If `True`, returned arrays share memory with output tensors
+                                  of this InferRequest instead of holding a copy of the data.
+                                  Their content is overwritten by the next inference.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -197,13 +253,14 @@ void regclass_InferRequest(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool share_outputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
             // Call Infer function
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -213,6 +270,10 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on input tensors.
             :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :param share_outputs: If `True`, returned arrays share memory with output tensors
+                                  of this InferRequest instead of holding a copy of the data.
+                                  Their content is overwritten by the next inference.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -719,6 +780,23 @@ void regclass_InferRequest(py::module m) {
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
 
+    cls.def(
+        "get_results",
+        [](InferRequestWrapper& self, bool share_outputs) {
+            return Common::outputs_to_dict(self._outputs, self._request, share_outputs);
+        },
+        py::arg("share_outputs") = false,
+        R"(
+            Gets all outputs tensors of this InferRequest.
+
+            :param share_outputs: If `True`, returned arrays share memory with output tensors
+                                  of this InferRequest instead of holding a copy of the data.
+                                  Their content is overwritten by the next inference.
+            :type share_outputs: bool
+            :return: Dictionary of results from output tensors with ports as keys.
+            :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
+        )");
+
     cls.def("__repr__", [](const InferRequestWrapper& self) {
         auto inputs_str = Common::docs::container_to_string(self._inputs, ",\n");
         auto outputs_str = Common::docs::container_to_string(self._outputs, ",\n");
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 #include <openvino/runtime/infer_request.hpp>
@@ -57,6 +59,8 @@ public:
 
     bool user_callback_defined = false;
     py::object userdata;
+    // Caller-provided numpy arrays bound as output tensors, kept alive by the request.
+    std::map<size_t, py::array> output_buffers;
 
     double get_latency() {
         auto execTime = std::chrono::duration_cast<ns>(_end_time - _start_time);
@@ -482,6 +482,69 @@ def test_infer_queue(device):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+def test_infer_queue_start_async_many(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    param = ops.parameter([2, 2], np.float32)
+    model = Model(ops.abs(param), [param])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, num_request)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    inputs = [np.full([2, 2], -i, dtype=np.float32) for i in range(jobs)]
+    infer_queue.set_callback(callback)
+    infer_queue.start_async_many(inputs, range(jobs))
+    infer_queue.wait_all()
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.abs(inputs[i]))
+
+
+def test_infer_queue_batch_callback(device):
+    jobs = 10
+    num_request = 4
+    core = Core()
+    param = ops.parameter([2, 2], np.float32)
+    model = Model(ops.abs(param), [param])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, num_request)
+    finished = []
+    batch_sizes = []
+
+    def callback(requests, userdata):
+        batch_sizes.append(len(requests))
+        finished.extend(userdata)
+
+    infer_queue.set_batch_callback(callback, 2)
+    infer_queue.start_async_many([{0: np.ones([2, 2], dtype=np.float32)} for _ in range(jobs)], range(jobs))
+    infer_queue.wait_all()
+    assert sorted(finished) == list(range(jobs))
+    assert all(0 < size <= 2 for size in batch_sizes)
+
+
+def test_infer_queue_batch_callback_timeout(device):
+    jobs = 10
+    num_request = 4
+    core = Core()
+    param = ops.parameter([2, 2], np.float32)
+    model = Model(ops.abs(param), [param])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, num_request)
+    finished = []
+
+    def callback(requests, userdata):
+        finished.extend(userdata)
+
+    # batch is never full, requests are returned to the pool by the timeout
+    infer_queue.set_batch_callback(callback, jobs * 2, timeout=1)
+    infer_queue.start_async_many([{0: np.ones([2, 2], dtype=np.float32)} for _ in range(jobs)], range(jobs))
+    infer_queue.wait_all()
+    assert sorted(finished) == list(range(jobs))
+
+
 def test_infer_queue_is_ready(device):
     core = Core()
     param = ops.parameter([10])
@@ -912,3 +975,29 @@ def test_array_like_input_async_infer_queue(device):
     infer_queue_list.wait_all()
     for i in range(jobs):
         assert np.array_equal(infer_queue_list[i].get_output_tensor().data, np.abs(input_data))
+
+
+def test_infer_share_outputs(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    results = request.infer({0: arr_1, 1: arr_2}, share_outputs=True)
+    output = request.model_outputs[0]
+    assert np.array_equal(results[output], arr_1 + arr_2)
+    # Result is a view on the output tensor of the request
+    assert np.shares_memory(results[output], request.get_output_tensor().data)
+
+    copied = request.get_results()
+    shared = request.get_results(share_outputs=True)
+    assert not np.shares_memory(copied[output], request.get_output_tensor().data)
+    assert np.shares_memory(shared[output], request.get_output_tensor().data)
+
+
+def test_set_output_buffers(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    output_buffer = np.zeros([2, 2], dtype=np.float32)
+    request.set_output_buffers({0: output_buffer})
+    request.infer({0: arr_1, 1: arr_2})
+    assert np.array_equal(output_buffer, arr_1 + arr_2)
+
+    with pytest.raises(TypeError) as e:
+        request.set_output_buffers({0: [1, 2, 3, 4]})
+    assert "Output buffer must be of numpy.array type!" in str(e.value)
@@ -75,6 +75,29 @@ namespace openvino
             return internal::handle(name.c_str());
         }
 
+        /**
+         * @fn void enableTrace(bool enable)
+         * @ingroup ie_dev_profiling
+         * @brief Starts or stops recording of annotated sections by the built-in tracer.
+         * @details The tracer is available if OpenVINO is built with ENABLE_PROFILING_TRACE. Setting the
+         *          OPENVINO_TRACE_FILE environment variable enables recording from the process start and
+         *          writes the trace to the given file at the process exit.
+         * @param enable [in] Whether sections are recorded
+         */
+        void enableTrace(bool enable);
+
+        /**
+         * @fn bool writeTrace(const std::string &path)
+         * @ingroup ie_dev_profiling
+         * @brief Writes sections recorded by the built-in tracer so far in Chrome trace JSON format,
+         *        which can be opened by chrome://tracing or Perfetto UI.
+         * @details Every thread keeps about a million of its first events. Scopes recorded after that are
+         *          dropped and counted in "otherData.dropped_scopes" of the trace.
+         * @param path [in] The trace file path
+         * @return false if the file can't be written or OpenVINO is built without ENABLE_PROFILING_TRACE
+         */
+        bool writeTrace(const std::string &path);
+
         /**
          * @fn handle_t handle(char const *name)
          * @ingroup ie_dev_profiling
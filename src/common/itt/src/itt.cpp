@@ -10,11 +10,19 @@
 #    include <ittnotify.h>
 #endif
 
+#ifdef ENABLE_PROFILING_TRACE
+#    include <memory>
+#    include <mutex>
+#    include <unordered_map>
+
+#    include "trace.hpp"
+#endif
+
 namespace openvino {
 namespace itt {
 namespace internal {
 
-#ifdef ENABLE_PROFILING_ITT
+#if defined(ENABLE_PROFILING_ITT) || defined(ENABLE_PROFILING_TRACE)
 
 static size_t callStackDepth() {
     static const char* env = std::getenv("OPENVINO_TRACE_DEPTH");
@@ -24,6 +32,78 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+#endif
+
+#if defined(ENABLE_PROFILING_TRACE)
+
+namespace {
+
+// The built-in tracer needs names of domains and tasks, so handles keep them along with ITT handles
+struct Handle {
+    std::string name;
+    void* itt = nullptr;
+};
+
+Handle* intern(const char* name, bool isDomain) {
+    // never destroyed, the trace written at process exit refers to the names
+    using Handles = std::unordered_map<std::string, std::unique_ptr<Handle>>;
+    static auto mutex = new std::mutex;
+    static auto domains = new Handles;
+    static auto handles = new Handles;
+    std::lock_guard<std::mutex> lock{*mutex};
+    auto& handle = (*(isDomain ? domains : handles))[name];
+    if (!handle) {
+        handle.reset(new Handle{name});
+#    ifdef ENABLE_PROFILING_ITT
+        handle->itt = isDomain ? static_cast<void*>(__itt_domain_create(name))
+                               : static_cast<void*>(__itt_string_handle_create(name));
+#    endif
+    }
+    return handle.get();
+}
+
+}  // namespace
+
+domain_t domain(char const* name) {
+    return reinterpret_cast<domain_t>(intern(name, true));
+}
+
+handle_t handle(char const* name) {
+    return reinterpret_cast<handle_t>(intern(name, false));
+}
+
+void taskBegin(domain_t d, handle_t t) {
+    if (!callStackDepth() || call_stack_depth++ < callStackDepth()) {
+        const auto domainHandle = reinterpret_cast<Handle*>(d);
+        const auto taskHandle = reinterpret_cast<Handle*>(t);
+#    ifdef ENABLE_PROFILING_ITT
+        __itt_task_begin(static_cast<__itt_domain*>(domainHandle->itt),
+                         __itt_null,
+                         __itt_null,
+                         static_cast<__itt_string_handle*>(taskHandle->itt));
+#    endif
+        trace::begin(domainHandle->name.c_str(), taskHandle->name.c_str());
+    }
+}
+
+void taskEnd(domain_t d) {
+    if (!callStackDepth() || --call_stack_depth < callStackDepth()) {
+#    ifdef ENABLE_PROFILING_ITT
+        __itt_task_end(static_cast<__itt_domain*>(reinterpret_cast<Handle*>(d)->itt));
+#    endif
+        trace::end();
+    }
+}
+
+void threadName(const char* name) {
+#    ifdef ENABLE_PROFILING_ITT
+    __itt_thread_set_name(name);
+#    endif
+    trace::threadName(name);
+}
+
+#elif defined(ENABLE_PROFILING_ITT)
+
 domain_t domain(char const* name) {
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
@@ -68,5 +148,26 @@ void threadName(const char*) {}
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
+
+#ifdef ENABLE_PROFILING_TRACE
+
+void enableTrace(bool enable) {
+    trace::setEnabled(enable);
+}
+
+bool writeTrace(const std::string& path) {
+    return trace::write(path);
+}
+
+#else
+
+void enableTrace(bool) {}
+
+bool writeTrace(const std::string&) {
+    return false;
+}
+
+#endif  // ENABLE_PROFILING_TRACE
+
 }  // namespace itt
 }  // namespace openvino
@@ -0,0 +1,263 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_PROFILING_TRACE
+
+#    include "trace.hpp"
+
+#    include <atomic>
+#    include <chrono>
+#    include <cstdint>
+#    include <cstdlib>
+#    include <fstream>
+#    include <iomanip>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <vector>
+
+namespace openvino {
+namespace itt {
+namespace trace {
+
+namespace {
+
+struct Event {
+    const char* domain;  // nullptr for the end of scope
+    const char* name;
+    uint64_t timestamp;  // nanoseconds since the collector start
+};
+
+// Events are appended only by the owning thread and read by the writer.
+// Chunks are never reallocated, so the reader needs only the published size of each chunk.
+struct Chunk {
+    static constexpr size_t capacity = 4096;
+    Event events[capacity];
+    std::atomic<size_t> size{0};
+    std::atomic<Chunk*> next{nullptr};
+};
+
+struct ThreadBuffer {
+    // the oldest events are kept, a thread which recorded that many drops the rest of its scopes
+    static constexpr size_t maxEvents = 256 * Chunk::capacity;
+
+    explicit ThreadBuffer(uint32_t id) : tid(id), tail(&head) {}
+
+    ~ThreadBuffer() {
+        for (auto chunk = head.next.load(); chunk != nullptr;) {
+            auto next = chunk->next.load();
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    void begin(const char* domain, const char* name, uint64_t timestamp) {
+        depth++;
+        // room is reserved for the ends of all recorded scopes, so the trace stays balanced
+        if (recordedDepth < depth - 1 || count + recordedDepth + 2 > maxEvents) {
+            dropped++;
+            return;
+        }
+        recordedDepth++;
+        push(domain, name, timestamp);
+    }
+
+    void end(uint64_t timestamp) {
+        // scopes opened before the collection was enabled are not closed
+        if (depth == 0)
+            return;
+        if (depth-- > recordedDepth)
+            return;
+        recordedDepth--;
+        push(nullptr, nullptr, timestamp);
+    }
+
+    const uint32_t tid;
+    std::string name;  // guarded by Collector::mutex
+    std::atomic<size_t> dropped{0};
+    Chunk head;
+
+private:
+    void push(const char* domain, const char* name, uint64_t timestamp) {
+        auto size = tail->size.load(std::memory_order_relaxed);
+        if (size == Chunk::capacity) {
+            auto chunk = new Chunk;
+            tail->next.store(chunk, std::memory_order_release);
+            tail = chunk;
+            size = 0;
+        }
+        tail->events[size] = {domain, name, timestamp};
+        tail->size.store(size + 1, std::memory_order_release);
+        count++;
+    }
+
+    size_t depth = 0;          // open scopes
+    size_t recordedDepth = 0;  // open scopes whose begin is recorded, they are the outermost ones
+    size_t count = 0;          // recorded events
+    Chunk* tail;
+};
+
+std::string escape(const char* str) {
+    std::string result;
+    for (; *str; ++str) {
+        switch (*str) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(*str) >= 0x20)
+                result += *str;
+        }
+    }
+    return result;
+}
+
+class Collector;
+Collector& collector();
+
+class Collector {
+public:
+    Collector() : start(std::chrono::steady_clock::now()) {
+        const char* env = std::getenv("OPENVINO_TRACE_FILE");
+        if (env && *env) {
+            path = env;
+            enabled = true;
+            // the trace requested by environment variable is written at process exit
+            std::atexit([] {
+                collector().writeAtExit();
+            });
+        }
+    }
+
+    // The collector is never destroyed: threads of TBB and other thread pools may still record
+    // scopes while static objects are destroyed at process exit.
+    ~Collector() = delete;
+
+    void writeAtExit() {
+        write(path);
+    }
+
+    uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // buffers are allocated for threads which recorded anything only
+    ThreadBuffer* buffer(bool create = true) {
+        static thread_local ThreadBuffer* current = nullptr;
+        if (current == nullptr && create) {
+            std::lock_guard<std::mutex> lock{mutex};
+            buffers.emplace_back(new ThreadBuffer(static_cast<uint32_t>(buffers.size())));
+            current = buffers.back().get();
+        }
+        return current;
+    }
+
+    void setThreadName(const char* name) {
+        auto current = buffer();
+        std::lock_guard<std::mutex> lock{mutex};
+        current->name = name;
+    }
+
+    bool write(const std::string& tracePath) {
+        std::ofstream out(tracePath);
+        if (!out.is_open())
+            return false;
+
+        std::lock_guard<std::mutex> lock{mutex};
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        auto separator = [&] {
+            if (!first)
+                out << ",\n";
+            first = false;
+        };
+        for (const auto& buffer : buffers) {
+            if (!buffer->name.empty()) {
+                separator();
+                out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+                    << ",\"args\":{\"name\":\"" << escape(buffer->name.c_str()) << "\"}}";
+            }
+            for (const Chunk* chunk = &buffer->head; chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire)) {
+                const auto size = chunk->size.load(std::memory_order_acquire);
+                for (size_t i = 0; i < size; ++i) {
+                    const auto& event = chunk->events[i];
+                    separator();
+                    out << "{\"ph\":\"" << (event.domain ? 'B' : 'E') << "\",\"pid\":1,\"tid\":" << buffer->tid
+                        << ",\"ts\":" << event.timestamp / 1000.0;
+                    if (event.domain)
+                        out << ",\"cat\":\"" << escape(event.domain) << "\",\"name\":\"" << escape(event.name) << '"';
+                    out << '}';
+                }
+            }
+        }
+        out << "],\"otherData\":{\"dropped_scopes\":" << droppedScopes() << "}}\n";
+        return out.good();
+    }
+
+    std::atomic<bool> enabled{false};
+
+private:
+    // guarded by mutex
+    size_t droppedScopes() const {
+        size_t dropped = 0;
+        for (const auto& buffer : buffers)
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        return dropped;
+    }
+
+    const std::chrono::steady_clock::time_point start;
+    std::string path;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+Collector& collector() {
+    static Collector* instance = new Collector;
+    return *instance;
+}
+
+}  // namespace
+
+bool enabled() {
+    return collector().enabled.load(std::memory_order_relaxed);
+}
+
+void setEnabled(bool enable) {
+    collector().enabled = enable;
+}
+
+void begin(const char* domain, const char* name) {
+    auto& c = collector();
+    if (!c.enabled.load(std::memory_order_relaxed))
+        return;
+    c.buffer()->begin(domain ? domain : "", name ? name : "", c.now());
+}
+
+void end() {
+    auto& c = collector();
+    auto buffer = c.buffer(false);
+    if (buffer != nullptr)
+        buffer->end(c.now());
+}
+
+void threadName(const char* name) {
+    collector().setThreadName(name);
+}
+
+bool write(const std::string& path) {
+    return collector().write(path);
+}
+
+}  // namespace trace
+}  // namespace itt
+}  // namespace openvino
+
+#endif  // ENABLE_PROFILING_TRACE
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Built-in collector of ITT scopes writing Chrome trace JSON
+ * @file trace.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+namespace openvino {
+namespace itt {
+namespace trace {
+
+bool enabled();
+
+void setEnabled(bool enable);
+
+/**
+ * @brief Records begin of a scope on the current thread.
+ * @param domain [in] Domain name, the pointer must stay valid until the trace is written
+ * @param name [in] Scope name, the pointer must stay valid until the trace is written
+ */
+void begin(const char* domain, const char* name);
+
+void end();
+
+void threadName(const char* name);
+
+bool write(const std::string& path);
+
+}  // namespace trace
+}  // namespace itt
+}  // namespace openvino
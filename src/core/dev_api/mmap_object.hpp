@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+
+/// \brief Maps the whole file into memory in read-only mode
+/// \param path Path to the file
+/// \return Buffer which keeps the file mapped while it is alive
+OPENVINO_API std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path);
+
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+
+OPENVINO_API std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT && _WIN32
+
+}  // namespace ov
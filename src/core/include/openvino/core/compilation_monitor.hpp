@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+/// \brief Stages of model compilation reported to \ref ov::CompilationMonitor
+enum class CompilationStage {
+    READ_MODEL,       //!< Reading of the model file by a frontend
+    TRANSFORMATIONS,  //!< Transformations of the model applied by a device plugin
+    GRAPH_BUILD,      //!< Creation of the device specific graph
+    WEIGHTS_REORDER,  //!< Creation of primitives and reordering of weights into device specific layouts
+};
+
+/// \brief CompilationMonitor reports progress of model compilation and allows to cancel it
+///
+/// \details While a \ref Scope object exists, the monitor is active on the thread which created
+/// the scope. pass::Manager checks the active monitor before every pass, device plugins report
+/// the stages of compilation and check the monitor between them. When the monitor is cancelled,
+/// the next check throws ov::Exception, so the compilation stops at the nearest check point.
+///
+/// Plugins may compile several graphs in parallel, so the callback can be called from different
+/// threads and the same stage can be reported several times.
+/// \ingroup ov_model_cpp_api
+class OPENVINO_API CompilationMonitor {
+public:
+    using ProgressCallback = std::function<void(CompilationStage stage)>;
+
+    /// \brief Makes the monitor active on the calling thread until the scope is destroyed
+    class OPENVINO_API Scope {
+    public:
+        explicit Scope(std::shared_ptr<CompilationMonitor> monitor);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::shared_ptr<CompilationMonitor> m_previous;
+    };
+
+    explicit CompilationMonitor(ProgressCallback callback = {});
+
+    CompilationMonitor(const CompilationMonitor&) = delete;
+    CompilationMonitor& operator=(const CompilationMonitor&) = delete;
+
+    /// \brief Requests cancellation of the compilation, can be called from any thread
+    void cancel() noexcept;
+
+    bool is_cancelled() const noexcept;
+
+    /// \brief Throws ov::Exception if the compilation is cancelled
+    void check_cancelled() const;
+
+    /// \brief Checks cancellation and notifies the callback about the start of the stage
+    void report(CompilationStage stage) const;
+
+    /// \return Monitor which is active on the calling thread or nullptr
+    static std::shared_ptr<CompilationMonitor> get_current();
+
+private:
+    ProgressCallback m_callback;
+    std::atomic<bool> m_cancelled{false};
+};
+}  // namespace ov
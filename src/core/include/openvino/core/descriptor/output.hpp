@@ -17,7 +17,7 @@
 #include "openvino/core/runtime_attribute.hpp"
 
 namespace ov {
-// The forward declaration of Node is needed here because Node has a deque of
+// The forward declaration of Node is needed here because Node has a list of
 // Outputs, and Output is an incomplete type at this point. STL containers of
 // incomplete type have undefined behavior according to the C++11 standard, and
 // in practice including node.hpp here was causing compilation errors on some
@@ -0,0 +1,165 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace descriptor {
+/// \brief Storage of node input or output descriptors.
+///
+/// Descriptors keep pointers to each other, so elements are never moved once created.
+/// Elements are allocated one by one, an empty list allocates nothing. The list takes exactly the
+/// space of std::deque<T> Node stored the descriptors in before, so the layout of Node is unchanged.
+template <typename T>
+class PortList {
+    template <typename Container, typename Value>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator(Container* container, size_t index) : m_container(container), m_index(index) {}
+
+        reference operator*() const {
+            return (*m_container)[m_index];
+        }
+        pointer operator->() const {
+            return &(*m_container)[m_index];
+        }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator result = *this;
+            ++m_index;
+            return result;
+        }
+        bool operator==(const Iterator& other) const {
+            return m_index == other.m_index;
+        }
+        bool operator!=(const Iterator& other) const {
+            return m_index != other.m_index;
+        }
+
+    private:
+        Container* m_container;
+        size_t m_index;
+    };
+
+public:
+    using iterator = Iterator<PortList, T>;
+    using const_iterator = Iterator<const PortList, const T>;
+
+    PortList() {
+        new (&m_storage) Elements();
+    }
+
+    PortList(const PortList& other) : PortList() {
+        for (const auto& element : other) {
+            emplace_back(element);
+        }
+    }
+
+    PortList& operator=(const PortList& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& element : other) {
+                emplace_back(element);
+            }
+        }
+        return *this;
+    }
+
+    ~PortList() {
+        elements().~Elements();
+    }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        std::unique_ptr<T> element(new T(std::forward<Args>(args)...));
+        elements().push_back(std::move(element));
+        return *elements().back();
+    }
+
+    void clear() {
+        elements().clear();
+    }
+
+    size_t size() const {
+        return elements().size();
+    }
+    bool empty() const {
+        return elements().empty();
+    }
+
+    T& operator[](size_t i) {
+        return *elements()[i];
+    }
+    const T& operator[](size_t i) const {
+        return *elements()[i];
+    }
+
+    T& at(size_t i) {
+        if (i >= size())
+            throw std::out_of_range("PortList index is out of range");
+        return (*this)[i];
+    }
+    const T& at(size_t i) const {
+        if (i >= size())
+            throw std::out_of_range("PortList index is out of range");
+        return (*this)[i];
+    }
+
+    T& back() {
+        return *elements().back();
+    }
+    const T& back() const {
+        return *elements().back();
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+    iterator end() {
+        return iterator(this, size());
+    }
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const {
+        return const_iterator(this, size());
+    }
+
+private:
+    using Elements = std::vector<std::unique_ptr<T>>;
+    // the storage of the replaced std::deque<T>
+    using Storage = typename std::aligned_storage<sizeof(std::deque<T>), alignof(std::deque<T>)>::type;
+    static_assert(sizeof(Elements) <= sizeof(Storage) && alignof(Elements) <= alignof(Storage),
+                  "PortList must fit into the storage of std::deque");
+
+    Elements& elements() {
+        return *reinterpret_cast<Elements*>(&m_storage);
+    }
+    const Elements& elements() const {
+        return *reinterpret_cast<const Elements*>(&m_storage);
+    }
+
+    Storage m_storage;
+};
+}  // namespace descriptor
+}  // namespace ov
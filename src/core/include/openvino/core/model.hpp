@@ -181,6 +181,17 @@ public:
 
     void validate_nodes_and_infer_types() const;
 
+    /// \brief Validates and infers types of the nodes which might be affected by modifications
+    ///        made since the previous validation of the model: new nodes, nodes with reconnected
+    ///        inputs or with changed input element types and shapes. Nodes without inputs and
+    ///        nodes with sub-graphs are always revalidated. The first call validates all nodes.
+    ///
+    /// \note Nodes modified in place (e.g. by attribute setters) are not detected, they have
+    ///       to be revalidated by the code which modifies them. If OV_INCREMENTAL_VALIDATION_CHECK
+    ///       environment variable is set, skipped nodes are revalidated as well and an exception
+    ///       is thrown if any of them changes its outputs.
+    void validate_nodes_and_infer_types_incrementally() const;
+
     /// \brief Returns the sum of the size of all nodes in the graph plus the size of
     /// all constant data. This has little value beyond comparing the relative size of
     /// graphs and should not be considered the actual memory consumption of a graph.
@@ -337,6 +348,8 @@ private:
     /// model and registers them, otherwise checks all the Parameters are registered.
     void prerequirements(bool detect_variables, bool detect_parameters);
 
+    void validate_nodes(bool incremental) const;
+
     static std::atomic<size_t> m_next_instance_id;
     std::string m_name;
     const std::string m_unique_name;
@@ -364,6 +377,11 @@ private:
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
 
     mutable std::mutex m_topological_sort_mutex;
+
+    // Input element types and shapes of the nodes at the moment of their last validation,
+    // created by the first incremental validation
+    struct ValidationCache;
+    mutable std::shared_ptr<ValidationCache> m_validation_cache;
 };
 
 OPENVINO_API
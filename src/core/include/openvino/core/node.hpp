@@ -25,6 +25,7 @@
 #include "openvino/core/deprecated.hpp"
 #include "openvino/core/descriptor/input.hpp"
 #include "openvino/core/descriptor/output.hpp"
+#include "openvino/core/descriptor/port_list.hpp"
 #include "openvino/core/descriptor/tensor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node_input.hpp"
@@ -503,8 +504,8 @@ private:
     mutable std::string m_unique_name;
     mutable std::atomic_bool m_name_changing{false};
     static std::atomic<size_t> m_next_instance_id;
-    std::deque<descriptor::Input> m_inputs;
-    std::deque<descriptor::Output> m_outputs;
+    descriptor::PortList<descriptor::Input> m_inputs;
+    descriptor::PortList<descriptor::Output> m_outputs;
     OPENVINO_SUPPRESS_DEPRECATED_START
     std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -70,6 +70,16 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to make Validate passes revalidate only nodes affected by graph
+    /// modifications instead of the whole model, see
+    /// \link ov::Model::validate_nodes_and_infer_types_incrementally() \endlink.
+    /// Enable it only if registered transformations revalidate nodes which attributes
+    /// they modify in place.
+    /// \param new_state Value "true" enables incremental validation; "false", otherwise
+    void set_incremental_validation(bool new_state) {
+        m_incremental_validation = new_state;
+    }
+
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -123,6 +133,7 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_incremental_validation = false;
 };
 }  // namespace pass
 }  // namespace ov
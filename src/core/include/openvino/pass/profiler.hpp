@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace pass {
+/// \brief Profiler collects statistics of transformations executed by \ref ov::pass::Manager
+///
+/// \details While a profiler object exists, every pass::Manager::run_passes call made on the
+/// thread which created the profiler reports to it, including managers created inside other
+/// passes. Statistics are aggregated by the path of pass names starting from the outermost
+/// manager, e.g. "MOCTransformations/CommonOptimizations/ConvertGather0D". Matcher callbacks
+/// are additionally reported as children of the pass which executed them.
+///
+/// Counting of added and removed nodes traverses the model after every pass, so the profiler
+/// is intended for analysis of compilation time only.
+///
+///     {
+///         pass::Profiler profiler;
+///         manager.run_passes(model);
+///         std::cout << profiler.to_json();
+///     }
+/// \ingroup ov_pass_cpp_api
+class OPENVINO_API Profiler {
+public:
+    struct PassStatistics {
+        /// \brief Pass names from the outermost manager separated by '/'
+        std::string name;
+        size_t runs = 0;
+        /// \brief Wall time of the pass including nested passes
+        double time_ms = 0;
+        /// \brief Wall time of Validate passes executed right after the pass
+        double validation_time_ms = 0;
+        /// \brief Number of matcher callbacks called for matched nodes
+        size_t callbacks_attempted = 0;
+        /// \brief Number of matcher callbacks which reported the model modification
+        size_t callbacks_succeeded = 0;
+        size_t nodes_added = 0;
+        size_t nodes_removed = 0;
+    };
+
+    Profiler();
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /// \return Statistics of all executed passes in order of their first execution
+    const std::vector<PassStatistics>& get_statistics() const {
+        return m_statistics;
+    }
+
+    /// \return Total wall time of the outermost passes including their validation
+    double get_total_time_ms() const {
+        return m_total_time_ms;
+    }
+
+    /// \return Statistics as JSON object {"total_time_ms": ..., "passes": [{...}, ...]}
+    std::string to_json() const;
+
+    /// \return Profiler which is active on the calling thread or nullptr
+    static Profiler* get_current();
+
+    /// \brief Notifications used by pass::Manager and pass::MatcherPass
+    void begin_pass(const std::string& name);
+    void end_pass(double time_ms, size_t nodes_added, size_t nodes_removed);
+    void add_validation_time(double time_ms);
+    void add_callback(const std::string& matcher_name, bool succeeded, double time_ms);
+
+private:
+    PassStatistics& get_statistics(const std::string& name);
+
+    std::vector<PassStatistics> m_statistics;
+    std::unordered_map<std::string, size_t> m_indices;
+    std::vector<size_t> m_stack;
+    size_t m_last_finished = static_cast<size_t>(-1);
+    double m_total_time_ms = 0;
+    Profiler* m_previous = nullptr;
+};
+}  // namespace pass
+}  // namespace ov
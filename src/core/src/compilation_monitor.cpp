@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/compilation_monitor.hpp"
+
+#include "openvino/core/except.hpp"
+
+namespace {
+thread_local std::shared_ptr<ov::CompilationMonitor> current_monitor;
+}  // namespace
+
+ov::CompilationMonitor::Scope::Scope(std::shared_ptr<CompilationMonitor> monitor)
+    : m_previous(std::move(current_monitor)) {
+    current_monitor = std::move(monitor);
+}
+
+ov::CompilationMonitor::Scope::~Scope() {
+    current_monitor = std::move(m_previous);
+}
+
+ov::CompilationMonitor::CompilationMonitor(ProgressCallback callback) : m_callback(std::move(callback)) {}
+
+void ov::CompilationMonitor::cancel() noexcept {
+    m_cancelled = true;
+}
+
+bool ov::CompilationMonitor::is_cancelled() const noexcept {
+    return m_cancelled;
+}
+
+void ov::CompilationMonitor::check_cancelled() const {
+    if (m_cancelled) {
+        throw ov::Exception("Model compilation is cancelled");
+    }
+}
+
+void ov::CompilationMonitor::report(CompilationStage stage) const {
+    check_cancelled();
+    if (m_callback) {
+        m_callback(stage);
+    }
+}
+
+std::shared_ptr<ov::CompilationMonitor> ov::CompilationMonitor::get_current() {
+    return current_monitor;
+}
@@ -8,6 +8,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "dimension_tracker.hpp"
 #include "itt.hpp"
 #include "layout_utils.hpp"
 #include "ngraph/evaluator.hpp"
@@ -21,10 +22,12 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/variable_context.hpp"
 #include "openvino/op/util/variable_extension.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/env_util.hpp"
 #include "shared_node_info.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
@@ -213,8 +216,91 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
         check_all_variables_registered(ordered_ops, m_variables);
 }
 
+namespace {
+// exact comparison including intervals and labels of dimensions
+bool same_shape(const ov::PartialShape& lhs, const ov::PartialShape& rhs) {
+    if (lhs != rhs)
+        return false;
+    for (size_t i = 0; lhs.rank().is_static() && i < lhs.size(); ++i) {
+        if (ov::DimensionTracker::get_label(lhs[i]) != ov::DimensionTracker::get_label(rhs[i]))
+            return false;
+    }
+    return true;
+}
+}  // namespace
+
+struct ov::Model::ValidationCache {
+    struct InputSignature {
+        size_t producer_id;
+        size_t output_index;
+        element::Type element_type;
+        PartialShape shape;
+
+        bool operator==(const InputSignature& other) const {
+            return producer_id == other.producer_id && output_index == other.output_index &&
+                   element_type == other.element_type && same_shape(shape, other.shape);
+        }
+    };
+    using Signature = std::vector<InputSignature>;
+
+    static Signature get_signature(const Node& node) {
+        Signature signature;
+        signature.reserve(node.get_input_size());
+        for (const auto& input : node.inputs()) {
+            const auto source = input.get_source_output();
+            signature.push_back(InputSignature{source.get_node()->get_instance_id(),
+                                               source.get_index(),
+                                               source.get_element_type(),
+                                               source.get_partial_shape()});
+        }
+        return signature;
+    }
+
+    // signatures of the nodes, indexed by node instance id
+    std::unordered_map<size_t, Signature> signatures;
+};
+
+namespace {
+struct OutputsSnapshot {
+    explicit OutputsSnapshot(const ov::Node& node) {
+        for (const auto& output : node.outputs()) {
+            element_types.push_back(output.get_element_type());
+            shapes.push_back(output.get_partial_shape());
+        }
+    }
+
+    bool operator==(const OutputsSnapshot& other) const {
+        if (element_types != other.element_types || shapes.size() != other.shapes.size())
+            return false;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            if (!same_shape(shapes[i], other.shapes[i]))
+                return false;
+        }
+        return true;
+    }
+
+    std::vector<ov::element::Type> element_types;
+    std::vector<ov::PartialShape> shapes;
+};
+}  // namespace
+
 void ov::Model::validate_nodes_and_infer_types() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::validate_nodes_and_infer_types");
+    validate_nodes(false);
+}
+
+void ov::Model::validate_nodes_and_infer_types_incrementally() const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::validate_nodes_and_infer_types_incrementally");
+    validate_nodes(true);
+}
+
+void ov::Model::validate_nodes(bool incremental) const {
+    static const bool check_incremental = ov::util::getenv_bool("OV_INCREMENTAL_VALIDATION_CHECK");
+
+    // the cache is filled by full validation too once incremental validation was requested for the model
+    if (incremental && !m_validation_cache)
+        m_validation_cache = std::make_shared<ValidationCache>();
+    std::unordered_map<size_t, ValidationCache::Signature> signatures;
 
     struct Counter {
         int cnt_assign = 0;
@@ -226,7 +312,26 @@ void ov::Model::validate_nodes_and_infer_types() const {
     std::unordered_set<const ov::descriptor::Tensor*> tensors;
 
     for (auto& node : get_ordered_ops()) {
-        node->revalidate_and_infer_types();
+        if (m_validation_cache) {
+            auto signature = ValidationCache::get_signature(*node);
+            const auto cached = m_validation_cache->signatures.find(node->get_instance_id());
+            const bool skip = incremental && node->get_input_size() != 0 &&
+                              !ov::is_type<op::util::MultiSubGraphOp>(node) &&
+                              cached != m_validation_cache->signatures.end() && cached->second == signature;
+            if (!skip) {
+                node->revalidate_and_infer_types();
+            } else if (check_incremental) {
+                const OutputsSnapshot outputs(*node);
+                node->revalidate_and_infer_types();
+                OPENVINO_ASSERT(outputs == OutputsSnapshot(*node),
+                                "Incremental validation skipped node ",
+                                node,
+                                " which was modified in place without revalidation");
+            }
+            signatures.emplace(node->get_instance_id(), std::move(signature));
+        } else {
+            node->revalidate_and_infer_types();
+        }
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -262,6 +367,9 @@ void ov::Model::validate_nodes_and_infer_types() const {
     if (!only_pairs)
         throw ov::Exception("Model is incorrect. Assign and ReadValue operations must be in pairs on the "
                             "network.");
+    // signatures of removed nodes are dropped
+    if (m_validation_cache)
+        m_validation_cache->signatures = std::move(signatures);
     for (const auto& output : outputs()) {
         OPENVINO_ASSERT(ov::layout::utils::is_compatible(ov::layout::get_layout(output), output.get_partial_shape()),
                         "Result '",
@@ -62,7 +62,7 @@ public:
         map(path, h);
     }
 
-#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     void set(const std::wstring& path) {
         auto h = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
         map(ov::util::wstring_to_string(path), h);
@@ -126,7 +126,7 @@ std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::stri
                                                                                        holder);
 }
 
-#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 
 std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path) {
     auto holder = std::make_shared<MapHolder>();
@@ -5,7 +5,9 @@
 #include "ngraph/pass/constant_folding.hpp"
 
 #include <ngraph/op/constant.hpp>
+#include <unordered_set>
 
+#include "dimension_tracker.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "ngraph/opsets/opset3.hpp"
@@ -14,12 +16,58 @@
 
 using namespace std;
 
+namespace {
+using OutputsSignature = std::vector<std::pair<ov::element::Type, ov::PartialShape>>;
+
+OutputsSignature get_outputs_signature(const ov::Node& node) {
+    OutputsSignature signature;
+    for (const auto& output : node.outputs()) {
+        signature.emplace_back(output.get_element_type(), output.get_partial_shape());
+    }
+    return signature;
+}
+
+bool same_signature(const OutputsSignature& lhs, const OutputsSignature& rhs) {
+    if (lhs != rhs)
+        return false;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        const auto& shape = lhs[i].second;
+        for (size_t j = 0; shape.rank().is_static() && j < shape.size(); ++j) {
+            if (ov::DimensionTracker::get_label(shape[j]) != ov::DimensionTracker::get_label(rhs[i].second[j]))
+                return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    // nodes created during folding have greater instance ids than the nodes of the original model
+    size_t last_original_id = 0;
+    for (const auto& node : f->get_ordered_ops()) {
+        last_original_id = std::max(last_original_id, node->get_instance_id());
+    }
+
     bool rewritten = pre_calculated_values_folding(f);
 
+    // Only nodes consuming outputs of new or changed nodes are revalidated.
+    // A node is considered changed if it replaced some output or if its revalidation changed its outputs.
+    std::unordered_set<const Node*> changed;
+    const auto is_changed = [&](const Output<Node>& output) {
+        const auto producer = output.get_node();
+        return producer->get_instance_id() > last_original_id || changed.count(producer);
+    };
+
     for (const auto& node : f->get_ordered_ops()) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            const auto inputs = node->input_values();
+            if (std::any_of(inputs.begin(), inputs.end(), is_changed)) {
+                const auto outputs = get_outputs_signature(*node);
+                node->validate_and_infer_types();
+                if (!same_signature(outputs, get_outputs_signature(*node))) {
+                    changed.insert(node.get());
+                }
+            }
         }
 
         OutputVector replacements(node->get_output_size());
@@ -46,6 +94,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(node, replacement);
 
+                    changed.insert(replacement.get_node());
                     rewritten = true;
                 }
             }
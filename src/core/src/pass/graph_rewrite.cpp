@@ -5,6 +5,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -16,6 +17,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/pass/profiler.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -57,6 +59,19 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+bool run_callback(const std::shared_ptr<pattern::Matcher>& m, const graph_rewrite_callback& callback) {
+    auto profiler = Profiler::get_current();
+    if (!profiler) {
+        return callback(*m.get());
+    }
+    const auto start = std::chrono::steady_clock::now();
+    bool status = callback(*m.get());
+    profiler->add_callback(m->get_name(),
+                           status,
+                           std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    return status;
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -241,7 +256,7 @@ void ov::pass::GraphRewrite::add_matcher(const std::shared_ptr<pattern::Matcher>
             if (m->match(node->output(0))) {
                 NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
                 NGRAPH_PASS_CALLBACK(m);
-                bool status = callback(*m.get());
+                bool status = run_callback(m, callback);
                 // explicitly clear Matcher state because it holds pointers to matched nodes
                 m->clear_state();
                 return status;
@@ -298,7 +313,7 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
         if (m->match(node->output(0))) {
             NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
             NGRAPH_PASS_CALLBACK(m);
-            bool status = callback(*m.get());
+            bool status = run_callback(m, callback);
             // explicitly clear Matcher state because it holds pointers to matched nodes
             m->clear_state();
             return status;
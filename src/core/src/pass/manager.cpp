@@ -5,11 +5,13 @@
 #include "ngraph/pass/manager.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "ngraph/function.hpp"
@@ -20,6 +22,8 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
+#include "openvino/core/compilation_monitor.hpp"
+#include "openvino/pass/profiler.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
@@ -32,6 +36,58 @@ PerfCounters& perf_counters() {
     static PerfCounters counters;
     return counters;
 }
+
+std::unordered_set<size_t> get_instance_ids(const std::shared_ptr<ov::Model>& model) {
+    std::unordered_set<size_t> ids;
+    for (const auto& op : model->get_ops()) {
+        ids.insert(op->get_instance_id());
+    }
+    return ids;
+}
+
+// Reports execution of a single pass to the active profiler
+class ProfilingScope {
+public:
+    ProfilingScope(Profiler* profiler, const std::shared_ptr<PassBase>& pass, const std::shared_ptr<ov::Model>& model)
+        : m_profiler(profiler),
+          m_model(model),
+          m_validation(profiler && dynamic_pointer_cast<Validate>(pass) != nullptr) {
+        if (!m_profiler) {
+            return;
+        }
+        if (!m_validation) {
+            m_profiler->begin_pass(pass->get_name());
+            m_nodes = get_instance_ids(m_model);
+        }
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    ~ProfilingScope() {
+        if (!m_profiler) {
+            return;
+        }
+        const auto time_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+        if (m_validation) {
+            m_profiler->add_validation_time(time_ms);
+            return;
+        }
+        size_t added = 0;
+        for (const auto& op : m_model->get_ops()) {
+            if (m_nodes.erase(op->get_instance_id()) == 0) {
+                added++;
+            }
+        }
+        m_profiler->end_pass(time_ms, added, m_nodes.size());
+    }
+
+private:
+    Profiler* m_profiler;
+    const std::shared_ptr<ov::Model>& m_model;
+    const bool m_validation;
+    std::unordered_set<size_t> m_nodes;
+    std::chrono::steady_clock::time_point m_start;
+};
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -55,6 +111,8 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
     static bool profile_enabled =
         ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    const auto profiler = Profiler::get_current();
+    const auto monitor = CompilationMonitor::get_current();
 
     size_t index = 0;
     ngraph::stopwatch pass_timer;
@@ -66,8 +124,13 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
             continue;
         }
+        // passes are the check points of the cancellation of model compilation
+        if (monitor) {
+            monitor->check_cancelled();
+        }
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::nGraphPass_LT, pass::perf_counters()[pass->get_type_info()]);
+        pass::ProfilingScope profiling_scope(profiler, pass, func);
 
         pass_timer.start();
 
@@ -93,7 +156,11 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (function_changed) {
-                    function_pass->run_on_model(func);
+                    if (m_incremental_validation) {
+                        func->validate_nodes_and_infer_types_incrementally();
+                    } else {
+                        function_pass->run_on_model(func);
+                    }
                     function_changed = false;
                 }
             } else {
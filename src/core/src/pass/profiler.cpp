@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/profiler.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace {
+thread_local ov::pass::Profiler* current_profiler = nullptr;
+
+std::string escape(const std::string& str) {
+    std::string result;
+    for (const auto c : str) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        if (static_cast<unsigned char>(c) >= 0x20) {
+            result += c;
+        }
+    }
+    return result;
+}
+}  // namespace
+
+ov::pass::Profiler::Profiler() : m_previous(current_profiler) {
+    current_profiler = this;
+}
+
+ov::pass::Profiler::~Profiler() {
+    current_profiler = m_previous;
+}
+
+ov::pass::Profiler* ov::pass::Profiler::get_current() {
+    return current_profiler;
+}
+
+ov::pass::Profiler::PassStatistics& ov::pass::Profiler::get_statistics(const std::string& name) {
+    auto it = m_indices.find(name);
+    if (it == m_indices.end()) {
+        it = m_indices.emplace(name, m_statistics.size()).first;
+        m_statistics.emplace_back();
+        m_statistics.back().name = name;
+    }
+    return m_statistics[it->second];
+}
+
+void ov::pass::Profiler::begin_pass(const std::string& name) {
+    const auto path = m_stack.empty() ? name : m_statistics[m_stack.back()].name + "/" + name;
+    get_statistics(path);
+    m_stack.push_back(m_indices[path]);
+}
+
+void ov::pass::Profiler::end_pass(double time_ms, size_t nodes_added, size_t nodes_removed) {
+    if (m_stack.empty()) {
+        return;
+    }
+    auto& statistics = m_statistics[m_stack.back()];
+    statistics.runs++;
+    statistics.time_ms += time_ms;
+    statistics.nodes_added += nodes_added;
+    statistics.nodes_removed += nodes_removed;
+    m_last_finished = m_stack.back();
+    m_stack.pop_back();
+    if (m_stack.empty()) {
+        m_total_time_ms += time_ms;
+    }
+}
+
+void ov::pass::Profiler::add_validation_time(double time_ms) {
+    if (m_last_finished < m_statistics.size()) {
+        m_statistics[m_last_finished].validation_time_ms += time_ms;
+    }
+    if (m_stack.empty()) {
+        m_total_time_ms += time_ms;
+    }
+}
+
+void ov::pass::Profiler::add_callback(const std::string& matcher_name, bool succeeded, double time_ms) {
+    // callbacks of matchers executed outside of pass::Manager are not attributed to any pass
+    if (m_stack.empty()) {
+        return;
+    }
+    auto& parent = m_statistics[m_stack.back()];
+    parent.callbacks_attempted++;
+    parent.callbacks_succeeded += succeeded ? 1 : 0;
+
+    // the reference to the parent is invalidated by insertion of a new element
+    auto& matcher = get_statistics(m_statistics[m_stack.back()].name + "/" + matcher_name);
+    matcher.runs++;
+    matcher.time_ms += time_ms;
+    matcher.callbacks_attempted++;
+    matcher.callbacks_succeeded += succeeded ? 1 : 0;
+}
+
+std::string ov::pass::Profiler::to_json() const {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"total_time_ms\":" << m_total_time_ms << ",\"passes\":[";
+    for (size_t i = 0; i < m_statistics.size(); ++i) {
+        const auto& statistics = m_statistics[i];
+        ss << (i ? ",\n" : "\n");
+        ss << "{\"name\":\"" << escape(statistics.name) << "\""
+           << ",\"runs\":" << statistics.runs << ",\"time_ms\":" << statistics.time_ms
+           << ",\"validation_time_ms\":" << statistics.validation_time_ms
+           << ",\"callbacks_attempted\":" << statistics.callbacks_attempted
+           << ",\"callbacks_succeeded\":" << statistics.callbacks_succeeded
+           << ",\"nodes_added\":" << statistics.nodes_added << ",\"nodes_removed\":" << statistics.nodes_removed
+           << "}";
+    }
+    ss << "]}";
+    return ss.str();
+}
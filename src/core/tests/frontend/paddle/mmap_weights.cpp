@@ -0,0 +1,137 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <frontend/shared/include/utils.hpp>
+#include <iterator>
+#include <map>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset7.hpp>
+
+#include "gtest/gtest.h"
+#include "paddle_utils.hpp"
+
+using namespace ov::frontend;
+
+namespace {
+const std::string model_name = std::string(TEST_PADDLE_MODELS_DIRNAME) + "2in_2out/2in_2out";
+
+// named Constants of the model, Paddle frontend names them after the persistable variables
+std::map<std::string, std::shared_ptr<ov::opset7::Constant>> get_named_constants(
+    const std::shared_ptr<ov::Model>& model) {
+    std::map<std::string, std::shared_ptr<ov::opset7::Constant>> constants;
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::opset7::Constant>(op);
+        if (constant && constant->get_friendly_name() != constant->get_name()) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    return constants;
+}
+
+std::shared_ptr<ov::Model> convert_from_path(const std::string& path) {
+    FrontEndManager fem;
+    const auto frontend = fem.load_by_framework(PADDLE_FE);
+    const auto input_model = frontend->load(path);
+    return frontend->convert(input_model);
+}
+
+std::shared_ptr<ov::Model> convert_from_streams() {
+    std::ifstream model_ifs(FrontEndTestUtils::make_model_path(model_name + ".pdmodel"),
+                            std::ios::in | std::ios::binary);
+    std::ifstream weights_ifs(FrontEndTestUtils::make_model_path(model_name + ".pdiparams"),
+                              std::ios::in | std::ios::binary);
+    std::istream* model_is(&model_ifs);
+    std::istream* weights_is(&weights_ifs);
+    FrontEndManager fem;
+    const auto frontend = fem.load_by_framework(PADDLE_FE);
+    const auto input_model = frontend->load(model_is, weights_is);
+    return frontend->convert(input_model);
+}
+
+void expect_equal_constants(const std::map<std::string, std::shared_ptr<ov::opset7::Constant>>& expected,
+                            const std::map<std::string, std::shared_ptr<ov::opset7::Constant>>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (const auto& item : expected) {
+        const auto found = actual.find(item.first);
+        ASSERT_NE(found, actual.end()) << "Missing Constant " << item.first;
+        const auto& constant = found->second;
+        ASSERT_EQ(constant->get_element_type(), item.second->get_element_type());
+        ASSERT_EQ(constant->get_shape(), item.second->get_shape());
+        EXPECT_EQ(0, std::memcmp(constant->get_data_ptr(), item.second->get_data_ptr(), constant->get_byte_size()))
+            << "Different data of Constant " << item.first;
+    }
+}
+}  // namespace
+
+TEST(Paddle_MmapWeights, mapped_weights_match_streamed) {
+    FrontEndTestUtils::setupTestEnv();
+    std::shared_ptr<ov::Model> streamed, mapped;
+    ASSERT_NO_THROW(streamed = convert_from_streams());
+    ASSERT_NO_THROW(mapped = convert_from_path(FrontEndTestUtils::make_model_path(model_name + ".pdmodel")));
+    const auto expected = get_named_constants(streamed);
+    ASSERT_FALSE(expected.empty());
+    expect_equal_constants(expected, get_named_constants(mapped));
+}
+
+TEST(Paddle_MmapWeights, misaligned_weights_are_copied) {
+    FrontEndTestUtils::setupTestEnv();
+    std::shared_ptr<ov::Model> streamed;
+    ASSERT_NO_THROW(streamed = convert_from_streams());
+    const auto expected = get_named_constants(streamed);
+    ASSERT_FALSE(expected.empty());
+
+    // Every tensor in the weights file is stored as a 16 byte header, the length of the tensor descriptor,
+    // the descriptor and the data. The descriptor is extended with padding bytes, which are not parsed by
+    // the frontend, so the data of every tensor starts at an odd offset of the mapped file.
+    std::ifstream weights_ifs(FrontEndTestUtils::make_model_path(model_name + ".pdiparams"),
+                              std::ios::in | std::ios::binary);
+    const std::string weights{std::istreambuf_iterator<char>(weights_ifs), std::istreambuf_iterator<char>()};
+    std::string misaligned;
+    size_t offset = 0;
+    for (const auto& item : expected) {
+        const size_t header_size = 16;
+        uint32_t desc_size = 0;
+        ASSERT_LE(offset + header_size + sizeof(desc_size), weights.size());
+        std::memcpy(&desc_size, weights.data() + offset + header_size, sizeof(desc_size));
+        const auto desc_offset = offset + header_size + sizeof(desc_size);
+        const auto data_size = item.second->get_byte_size();
+        ASSERT_LE(desc_offset + desc_size + data_size, weights.size());
+
+        misaligned.append(weights, offset, header_size);
+        const auto padding = (5 - (misaligned.size() + sizeof(desc_size) + desc_size) % 4) % 4;
+        const auto padded_desc_size = static_cast<uint32_t>(desc_size + padding);
+        misaligned.append(reinterpret_cast<const char*>(&padded_desc_size), sizeof(padded_desc_size));
+        misaligned.append(weights, desc_offset, desc_size);
+        misaligned.append(padding, '\0');
+        ASSERT_EQ(misaligned.size() % 4, 1u);
+        misaligned.append(weights, desc_offset + desc_size, data_size);
+        offset = desc_offset + desc_size + data_size;
+    }
+    ASSERT_EQ(offset, weights.size()) << "Unexpected layout of the weights file";
+
+    const auto path = ::testing::TempDir() + "paddle_misaligned_weights";
+    {
+        std::ifstream model_ifs(FrontEndTestUtils::make_model_path(model_name + ".pdmodel"),
+                                std::ios::in | std::ios::binary);
+        std::ofstream model_ofs(path + ".pdmodel", std::ios::out | std::ios::binary);
+        model_ofs << model_ifs.rdbuf();
+        std::ofstream weights_ofs(path + ".pdiparams", std::ios::out | std::ios::binary);
+        weights_ofs << misaligned;
+    }
+    std::shared_ptr<ov::Model> mapped;
+    ASSERT_NO_THROW(mapped = convert_from_path(path + ".pdmodel"));
+    std::remove((path + ".pdmodel").c_str());
+    std::remove((path + ".pdiparams").c_str());
+
+    const auto actual = get_named_constants(mapped);
+    expect_equal_constants(expected, actual);
+    for (const auto& item : actual) {
+        const auto address = reinterpret_cast<uintptr_t>(item.second->get_data_ptr());
+        EXPECT_EQ(address % item.second->get_element_type().size(), 0u) << "Misaligned data of " << item.first;
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "openvino/itt.hpp"
+
+namespace {
+OV_ITT_DOMAIN(ov_itt_trace_test, "ov_itt_trace_test");
+
+// value of a "key":value or "key":"value" field of a single event line
+std::string field(const std::string& line, const std::string& key) {
+    const auto pattern = "\"" + key + "\":";
+    auto pos = line.find(pattern);
+    if (pos == std::string::npos)
+        return {};
+    pos += pattern.size();
+    if (line[pos] == '"')
+        return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+    return line.substr(pos, line.find_first_of(",}", pos) - pos);
+}
+}  // namespace
+
+TEST(itt_trace, nested_scopes_from_several_threads) {
+#ifndef ENABLE_PROFILING_TRACE
+    GTEST_SKIP() << "OpenVINO is built without ENABLE_PROFILING_TRACE";
+#else
+    const size_t threads_num = 4, iterations = 100;
+    openvino::itt::enableTrace(true);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threads_num; t++) {
+        threads.emplace_back([] {
+            for (size_t i = 0; i < iterations; i++) {
+                OV_ITT_SCOPED_TASK(ov_itt_trace_test, "outer");
+                {
+                    OV_ITT_SCOPED_TASK(ov_itt_trace_test, "inner");
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads)
+        thread.join();
+    openvino::itt::enableTrace(false);
+
+    const auto path = ::testing::TempDir() + "ov_itt_trace_test.json";
+    ASSERT_TRUE(openvino::itt::writeTrace(path));
+    std::ifstream trace(path);
+    ASSERT_TRUE(trace.is_open());
+    std::string line;
+    ASSERT_TRUE(std::getline(trace, line, '['));
+    ASSERT_EQ("{\"displayTimeUnit\":\"ns\",\"traceEvents\":", line);
+
+    // scopes of the test domain, per thread, in the order of their begin events
+    std::map<std::string, std::vector<std::pair<std::string, int>>> scopes;
+    std::map<std::string, int> depths;
+    std::string last;
+    while (std::getline(trace, line)) {
+        last = line;
+        const auto ph = field(line, "ph");
+        const auto tid = field(line, "tid");
+        if (ph == "B") {
+            depths[tid]++;
+            if (field(line, "cat") == "ov_itt_trace_test")
+                scopes[tid].emplace_back(field(line, "name"), depths[tid]);
+        } else if (ph == "E") {
+            ASSERT_GT(depths[tid]--, 0) << "Unbalanced end of scope: " << line;
+        }
+    }
+    std::remove(path.c_str());
+    ASSERT_NE(std::string::npos, last.find("}],")) << "The trace is not terminated";
+
+    for (const auto& depth : depths)
+        EXPECT_EQ(0, depth.second) << "Unclosed scope in thread " << depth.first;
+    ASSERT_EQ(threads_num, scopes.size());
+    for (const auto& thread_scopes : scopes) {
+        ASSERT_EQ(2 * iterations, thread_scopes.second.size());
+        for (size_t i = 0; i < thread_scopes.second.size(); i += 2) {
+            const auto& outer = thread_scopes.second[i];
+            const auto& inner = thread_scopes.second[i + 1];
+            EXPECT_EQ("outer", outer.first);
+            EXPECT_EQ("inner", inner.first);
+            EXPECT_EQ(outer.second + 1, inner.second);
+        }
+    }
+#endif
+}
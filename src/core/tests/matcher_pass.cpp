@@ -17,6 +17,7 @@
 #include "ngraph/opsets/opset3.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "openvino/pass/profiler.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -104,3 +105,28 @@ TEST(pattern, matcher_pass) {
         ASSERT_TRUE(f->get_ops().size() == 3);
     }
 }
+
+TEST(pattern, matcher_pass_profiling) {
+    auto a = make_shared<opset3::Parameter>(element::f32, Shape{1});
+    auto b = make_shared<opset3::Relu>(a);
+    auto c = make_shared<opset3::Relu>(b);
+    auto f = std::make_shared<Function>(ngraph::NodeVector{c}, ParameterVector{a});
+
+    ov::pass::Profiler profiler;
+    ASSERT_EQ(&profiler, ov::pass::Profiler::get_current());
+    pass::Manager manager;
+    manager.register_pass<TestMatcherPass>();
+    manager.run_passes(f);
+
+    const auto& statistics = profiler.get_statistics();
+    ASSERT_EQ(statistics.size(), 2);
+    EXPECT_EQ(statistics[0].name, "ReluReluFusion");
+    EXPECT_EQ(statistics[0].runs, 1);
+    EXPECT_EQ(statistics[0].callbacks_attempted, 1);
+    EXPECT_EQ(statistics[0].callbacks_succeeded, 1);
+    EXPECT_EQ(statistics[0].nodes_added, 1);
+    EXPECT_EQ(statistics[0].nodes_removed, 2);
+    EXPECT_EQ(statistics[1].name, "ReluReluFusion/ReluReluFusion");
+    EXPECT_EQ(statistics[1].callbacks_attempted, 1);
+    EXPECT_NE(profiler.to_json().find("\"name\":\"ReluReluFusion\""), std::string::npos);
+}
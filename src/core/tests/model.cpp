@@ -1932,3 +1932,27 @@ TEST(model, clone_model) {
     const auto res = fc.compare(model, cloned_model);
     EXPECT_TRUE(res.valid) << res.message;
 }
+
+TEST(model, incremental_validation) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto convert = std::make_shared<ov::opset8::Convert>(relu, ov::element::f32);
+    auto model = std::make_shared<ov::Model>(convert, ov::ParameterVector{arg0});
+    model->validate_nodes_and_infer_types_incrementally();
+
+    // shape changes are propagated starting from the parameter
+    arg0->set_partial_shape({2, 3});
+    model->validate_nodes_and_infer_types_incrementally();
+    EXPECT_EQ(model->output().get_partial_shape(), (ov::PartialShape{2, 3}));
+
+    // in place modification of a node with unchanged inputs is not detected
+    convert->set_convert_element_type(ov::element::f16);
+    model->validate_nodes_and_infer_types_incrementally();
+    EXPECT_EQ(model->output().get_element_type(), ov::element::f32);
+
+    // new nodes are validated
+    auto abs = std::make_shared<ov::opset8::Abs>(relu);
+    convert->input(0).replace_source_output(abs);
+    model->validate_nodes_and_infer_types_incrementally();
+    EXPECT_EQ(model->output().get_element_type(), ov::element::f16);
+}
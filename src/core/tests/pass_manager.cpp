@@ -12,6 +12,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "openvino/core/compilation_monitor.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +43,34 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+class CountingPass : public pass::FunctionPass {
+public:
+    explicit CountingPass(size_t& runs) : m_runs(runs) {}
+    bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override {
+        m_runs++;
+        return false;
+    }
+
+private:
+    size_t& m_runs;
+};
+}  // namespace
+
+TEST(pass_manager, cancelled_compilation) {
+    size_t runs = 0;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<CountingPass>(runs);
+    pass_manager.register_pass<CountingPass>(runs);
+    auto graph = make_test_graph();
+
+    auto monitor = std::make_shared<ov::CompilationMonitor>();
+    ov::CompilationMonitor::Scope scope{monitor};
+    pass_manager.run_passes(graph);
+    EXPECT_EQ(runs, 2);
+
+    monitor->cancel();
+    EXPECT_THROW(pass_manager.run_passes(graph), ov::Exception);
+    EXPECT_EQ(runs, 2);
+}
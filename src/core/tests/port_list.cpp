@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/descriptor/port_list.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "openvino/opsets/opset8.hpp"
+
+using namespace ov;
+using namespace ov::descriptor;
+
+namespace {
+// counts live instances to check that every element is destroyed exactly once
+struct Counted {
+    explicit Counted(int value) : value(value) {
+        ++alive;
+    }
+    Counted(const Counted& other) : value(other.value) {
+        ++alive;
+    }
+    ~Counted() {
+        --alive;
+    }
+    int value;
+    static int alive;
+};
+int Counted::alive = 0;
+}  // namespace
+
+TEST(port_list, growth) {
+    PortList<std::string> list;
+    EXPECT_TRUE(list.empty());
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(list.emplace_back(std::to_string(i)), std::to_string(i));
+        EXPECT_EQ(list.size(), i + 1);
+        EXPECT_EQ(list.back(), std::to_string(i));
+    }
+    for (size_t i = 0; i < list.size(); ++i) {
+        EXPECT_EQ(list[i], std::to_string(i));
+        EXPECT_EQ(list.at(i), std::to_string(i));
+    }
+    EXPECT_THROW(list.at(5), std::out_of_range);
+}
+
+TEST(port_list, references_are_stable_on_insert) {
+    PortList<int> list;
+    std::vector<const int*> addresses;
+    for (int i = 0; i < 10; ++i) {
+        addresses.push_back(&list.emplace_back(i));
+        for (int j = 0; j <= i; ++j) {
+            ASSERT_EQ(&list[j], addresses[j]) << "Element " << j << " moved after insertion of element " << i;
+            ASSERT_EQ(*addresses[j], j);
+        }
+    }
+}
+
+TEST(port_list, iteration) {
+    PortList<int> list;
+    EXPECT_EQ(list.begin(), list.end());
+    for (int i = 0; i < 7; ++i) {
+        list.emplace_back(i);
+    }
+    std::vector<int> values;
+    for (auto& value : list) {
+        values.push_back(value);
+        value *= 2;
+    }
+    std::vector<int> expected(7);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(values, expected);
+
+    const auto& const_list = list;
+    EXPECT_EQ(std::distance(const_list.begin(), const_list.end()), 7);
+    EXPECT_EQ(std::accumulate(const_list.begin(), const_list.end(), 0), 42);
+    EXPECT_EQ(*std::max_element(const_list.begin(), const_list.end()), 12);
+}
+
+TEST(port_list, copy_and_clear) {
+    {
+        PortList<Counted> list;
+        for (int i = 0; i < 4; ++i) {
+            list.emplace_back(i);
+        }
+        EXPECT_EQ(Counted::alive, 4);
+
+        auto copy = list;
+        EXPECT_EQ(Counted::alive, 8);
+        ASSERT_EQ(copy.size(), list.size());
+        for (size_t i = 0; i < list.size(); ++i) {
+            EXPECT_EQ(copy[i].value, list[i].value);
+            EXPECT_NE(&copy[i], &list[i]);
+        }
+
+        list.clear();
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(Counted::alive, 4);
+        list.emplace_back(42);
+        copy = list;
+        ASSERT_EQ(copy.size(), 1u);
+        EXPECT_EQ(copy[0].value, 42);
+        EXPECT_EQ(Counted::alive, 2);
+    }
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(port_list, layout_of_replaced_deque) {
+    EXPECT_EQ(sizeof(PortList<descriptor::Input>), sizeof(std::deque<descriptor::Input>));
+    EXPECT_EQ(alignof(PortList<descriptor::Input>), alignof(std::deque<descriptor::Input>));
+    EXPECT_EQ(sizeof(PortList<descriptor::Output>), sizeof(std::deque<descriptor::Output>));
+    EXPECT_EQ(alignof(PortList<descriptor::Output>), alignof(std::deque<descriptor::Output>));
+}
+
+TEST(port_list, node_with_many_inputs_and_outputs) {
+    const size_t inputs_num = 5;
+    OutputVector inputs;
+    for (size_t i = 0; i < inputs_num; ++i) {
+        inputs.push_back(std::make_shared<opset8::Parameter>(element::f32, Shape{1, 2}));
+    }
+    const auto concat = std::make_shared<opset8::Concat>(inputs, 0);
+    const auto axis = opset8::Constant::create(element::i64, Shape{}, {0});
+    const auto split = std::make_shared<opset8::Split>(concat, axis, inputs_num);
+
+    ASSERT_EQ(concat->get_input_size(), inputs_num);
+    for (size_t i = 0; i < inputs_num; ++i) {
+        EXPECT_EQ(concat->input_value(i), inputs[i]);
+        const auto targets = inputs[i].get_target_inputs();
+        ASSERT_EQ(targets.size(), 1u);
+        EXPECT_EQ(targets.begin()->get_node(), concat.get());
+        EXPECT_EQ(targets.begin()->get_index(), i);
+    }
+    ASSERT_EQ(split->get_output_size(), inputs_num);
+    for (size_t i = 0; i < inputs_num; ++i) {
+        EXPECT_EQ(split->get_output_shape(i), (Shape{1, 2}));
+        EXPECT_EQ(split->output(i).get_index(), i);
+    }
+}
@@ -6,6 +6,7 @@
 
 #include <exception>
 #include <functional>
+#include <ie_parallel.hpp>
 #include <numeric>
 #include <sstream>
 
@@ -15,6 +16,7 @@
 #include "exceptions.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/util/multi_subgraph_base.hpp"
 #include "onnx_framework_node.hpp"
 #include "onnx_import/core/node.hpp"
 #include "onnx_import/core/null_node.hpp"
@@ -117,6 +119,52 @@ Model::ModelOpSet build_model_opset(const ONNX_NAMESPACE::ModelProto& model_prot
     return opset;
 }
 
+/// Checks if any node of the subgraphs held in the node's attributes (at any nesting level)
+/// consumes a Constant node created in the parent graph or one of its ancestors.
+bool uses_parent_constants(const ONNX_NAMESPACE::NodeProto& node_proto, const Graph& parent_graph) {
+    for (const auto& attribute : node_proto.attribute()) {
+        std::vector<const ONNX_NAMESPACE::GraphProto*> graphs;
+        if (attribute.has_g()) {
+            graphs.push_back(&attribute.g());
+        }
+        for (const auto& graph : attribute.graphs()) {
+            graphs.push_back(&graph);
+        }
+        for (const auto graph : graphs) {
+            for (const auto& subgraph_node : graph->node()) {
+                for (const auto& input : subgraph_node.input()) {
+                    if (!input.empty() && parent_graph.is_ng_node_in_cache(input) &&
+                        op::is_constant(parent_graph.get_ng_node_from_cache(input).get_node())) {
+                        return true;
+                    }
+                }
+                if (uses_parent_constants(subgraph_node, parent_graph)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/// \brief Names nodes which have no explicit friendly name in the order of the graph traversal.
+///        Default names contain the instance id of a node, which depends on the thread scheduling for nodes
+///        created concurrently, so such nodes are named after the traversal order instead.
+void set_traversal_order_names(const std::string& prefix, const NodeVector& ordered_ops) {
+    std::size_t index = 0;
+    for (const auto& op : ordered_ops) {
+        if (op->get_friendly_name() == op->get_name()) {
+            op->set_friendly_name(prefix + op->get_type_name() + "_" + std::to_string(index++));
+        }
+        if (const auto multi_subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (std::size_t i = 0; i < multi_subgraph_op->get_internal_subgraphs_size(); ++i) {
+                set_traversal_order_names(op->get_friendly_name() + "/body_" + std::to_string(i) + "/",
+                                          multi_subgraph_op->get_function(static_cast<int>(i))->get_ordered_ops());
+            }
+        }
+    }
+}
+
 /// Copies only the extensions required by the Subgraph class.
 /// The source is an extension holder retrieved from the parent graph object.
 ov::frontend::ExtensionHolder subgraph_required_extensions(
@@ -143,24 +191,40 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
 
     std::map<std::string, Tensor> initializers;
 
-    // Process all initializers in the graph
-    for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
-        if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
-            try {
-                ng_constant = tensor.get_ng_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ngraph::ngraph_error&) {
-                ng_constant = ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
-            }
+    // Process all initializers in the graph. Constant nodes are created concurrently since decoding
+    // of one initializer does not depend on the others, then they are named and stored in cache
+    // in the model order.
+    const auto& initializer_tensors = m_model->get_graph().initializer();
+    std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(initializer_tensors.size());
+    std::vector<std::exception_ptr> errors(initializer_tensors.size());
+    InferenceEngine::parallel_for(ng_constants.size(), [&](std::size_t i) {
+        const auto& initializer_tensor = initializer_tensors.Get(static_cast<int>(i));
+        if (!initializer_tensor.has_name()) {
+            return;
+        }
+        const Tensor tensor{initializer_tensor, model_proto};
+        try {
+            ng_constants[i] = tensor.get_ng_constant();
+        } catch (const error::invalid_external_data&) {
+            // invalid external data makes initializers creation impossible
+            errors[i] = std::current_exception();
+        } catch (const ngraph::ngraph_error&) {
+            ng_constants[i] = ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
 
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+    for (std::size_t i = 0; i < ng_constants.size(); ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        const auto& initializer_tensor = initializer_tensors.Get(static_cast<int>(i));
+        if (initializer_tensor.has_name()) {
+            initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor, model_proto});
+            ng_constants[i]->set_friendly_name(initializer_tensor.name());
+            ng_constants[i]->get_output_tensor(0).set_names({initializer_tensor.name()});
+            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constants[i]));
         }
     }
 
@@ -218,11 +282,7 @@ void Graph::convert_to_ngraph_nodes() {
     for (const auto& node_proto : m_model->get_graph().node()) {
         const Node node{node_proto, *this};
         if (node.has_subgraphs()) {
-            const auto& subgraphs = node.get_subgraphs();
-            for (auto& kv : subgraphs) {
-                auto& subgraph = kv.second;
-                subgraph->convert();
-            }
+            convert_subgraphs(node_proto, node);
         }
         OutputVector ng_nodes{make_ng_nodes(node)};
         ++completed;
@@ -230,6 +290,44 @@ void Graph::convert_to_ngraph_nodes() {
     }
 }
 
+void Graph::convert_subgraphs(const ONNX_NAMESPACE::NodeProto& node_proto, const Node& node) {
+    std::vector<std::string> names;
+    std::vector<std::shared_ptr<Subgraph>> subgraphs;
+    for (const auto& kv : node.get_subgraphs()) {
+        names.push_back(kv.first);
+        subgraphs.push_back(kv.second);
+    }
+    // Subgraphs (e.g. branches of If) are independent unless they connect to the same Constant node of
+    // the parent scope, which would modify its set of target inputs concurrently. Custom conversion
+    // extensions are not required to be thread-safe, so they also force the sequential conversion.
+    std::vector<std::shared_ptr<Function>> functions(subgraphs.size());
+    if (subgraphs.size() > 1 && m_extensions.conversions.empty() && !detail::uses_parent_constants(node_proto, *this)) {
+        std::vector<std::exception_ptr> errors(subgraphs.size());
+        InferenceEngine::parallel_for(subgraphs.size(), [&](std::size_t i) {
+            try {
+                functions[i] = subgraphs[i]->convert();
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        // the first error in the model order is reported, as for the sequential conversion
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        // default names of the nodes created concurrently depend on the scheduling
+        for (std::size_t i = 0; i < functions.size(); ++i) {
+            detail::set_traversal_order_names(node.output(0) + "/" + names[i] + "/",
+                                              functions[i]->get_ordered_ops());
+        }
+    } else {
+        for (std::size_t i = 0; i < subgraphs.size(); ++i) {
+            functions[i] = subgraphs[i]->convert();
+        }
+    }
+}
+
 void Graph::remove_dangling_parameters() {
     const auto any_tensor_name_matches_onnx_output = [](const Output<ov::Node>& param_output,
                                                         const ONNX_NAMESPACE::GraphProto& graph) {
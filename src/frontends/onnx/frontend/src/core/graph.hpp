@@ -60,6 +60,7 @@ protected:
     virtual OutputVector make_framework_nodes(const Node& onnx_node);
     void decode_to_framework_nodes();
     void convert_to_ngraph_nodes();
+    void convert_subgraphs(const ONNX_NAMESPACE::NodeProto& node_proto, const Node& node);
     void remove_dangling_parameters();
     std::shared_ptr<Function> create_function();
 
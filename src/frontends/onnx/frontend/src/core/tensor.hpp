@@ -7,10 +7,12 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -355,8 +357,15 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    /// \brief      Tensor object created from its protobuf representation.
+    ///
+    /// \param[in]  tensor       The tensor protobuf representation object.
+    /// \param[in]  model_proto  The model which owns the tensor. If it's set, Constants created from the tensor
+    ///                          reference its raw data instead of copying it and keep the model alive.
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
+          m_model_proto{std::move(model_proto)},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
@@ -483,11 +492,11 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (auto shared_constant = make_shared_ng_constant(type)) {
+            return shared_constant;
+        }
         int data_size = detail::get_data_size(*m_tensor_proto);
-        if (detail::has_tensor_external_data(*m_tensor_proto)) {
-            auto external_data = detail::load_external_data(*m_tensor_proto);
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, detail::get_data_ptr(*m_tensor_proto));
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -508,6 +517,9 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (auto shared_constant = make_shared_ng_constant(type)) {
+            return shared_constant;
+        }
         auto data = get_data<T>();
         auto data_size = data.size();
         if (data_size == shape_size(m_shape)) {
@@ -523,7 +535,56 @@ private:
         return constant;
     }
 
+    /// \brief      Creates a Constant referencing the tensor data without copying it: external data is
+    ///             referenced inside the mapped external file, raw data inside the owning model.
+    ///             External data which is misaligned for the element type is copied.
+    ///
+    /// \return     The Constant or nullptr if the data can't be shared.
+    std::shared_ptr<ngraph::op::Constant> make_shared_ng_constant(const element::Type& type) const {
+        const size_t byte_size = shape_size(m_shape) * type.size();
+        std::shared_ptr<ngraph::op::Constant> constant{nullptr};
+        if (detail::has_tensor_external_data(*m_tensor_proto)) {
+            auto external_data = detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data();
+            if (external_data->size() < byte_size) {
+                throw error::tensor::shape_doesnt_match_data_size{};
+            }
+            if (reinterpret_cast<uintptr_t>(external_data->get_ptr()) % type.size() == 0) {
+                constant = std::make_shared<ngraph::op::Constant>(
+                    type,
+                    m_shape,
+                    std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                        external_data->get_ptr<char>(),
+                        byte_size,
+                        external_data));
+            } else {
+                // the offset in the external file may be misaligned for the element type,
+                // so the data is copied into the aligned buffer of the Constant
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data->get_ptr());
+            }
+        } else if (m_model_proto && m_tensor_proto->has_raw_data() && !m_tensor_proto->raw_data().empty()) {
+            const auto& raw_data = m_tensor_proto->raw_data();
+            if (raw_data.size() != byte_size) {
+                throw error::tensor::shape_doesnt_match_data_size{};
+            }
+            constant = std::make_shared<ngraph::op::Constant>(
+                type,
+                m_shape,
+                std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+                    const_cast<char*>(raw_data.data()),
+                    byte_size,
+                    m_model_proto));
+        } else {
+            return nullptr;
+        }
+
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
     Shape m_shape;
 };
 
@@ -217,6 +217,15 @@ struct onnx_editor::ONNXModelEditor::Impl {
 
     Impl() = delete;
 
+    /// \brief Returns the model for modification. Constants of already converted models may
+    ///        reference initializers data of the model, so it's copied first if it's still shared.
+    ONNX_NAMESPACE::ModelProto* mutable_model_proto() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+        }
+        return m_model_proto.get();
+    }
+
     Impl(const std::string& model_path)
         : m_model_proto{
               std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))} {}
@@ -276,7 +285,7 @@ void onnx_editor::ONNXModelEditor::serialize(const std::string& out_file_path) c
 }
 
 void onnx_editor::ONNXModelEditor::set_input_types(const std::map<std::string, element::Type_t>& input_types) {
-    auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto* onnx_graph = m_pimpl->mutable_model_proto()->mutable_graph();
 
     for (const auto& input_desc : input_types) {
         auto* onnx_input = find_graph_input(*onnx_graph, input_desc.first);
@@ -309,7 +318,7 @@ element::Type_t onnx_editor::ONNXModelEditor::get_input_type(const std::string&
 }
 
 void onnx_editor::ONNXModelEditor::set_input_shapes(const std::map<std::string, ngraph::PartialShape>& input_shapes) {
-    auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto* onnx_graph = m_pimpl->mutable_model_proto()->mutable_graph();
 
     for (const auto& input_desc : input_shapes) {
         auto* onnx_input = find_graph_input(*onnx_graph, input_desc.first);
@@ -371,10 +380,11 @@ void onnx_editor::ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>
         return;
     }
 
+    auto onnx_graph = m_pimpl->mutable_model_proto()->mutable_graph();
     InferShapesAutoRelease onnx_shapes(m_pimpl->m_model_proto);
     onnx_shapes.infer_shapes();
 
-    SubgraphExtractor editor{*(m_pimpl->m_model_proto->mutable_graph())};
+    SubgraphExtractor editor{*onnx_graph};
     editor.add_new_inputs(inputs, merge_inputs);
     editor.add_new_outputs(outputs);
     editor.extract_subgraph(outputs);
@@ -449,7 +459,7 @@ std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
-    auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto onnx_graph = m_pimpl->mutable_model_proto()->mutable_graph();
 
     for (const auto& input : input_values) {
         auto& name = input.first;
@@ -474,7 +484,7 @@ void onnx_editor::ONNXModelEditor::set_input_values(
 void onnx_editor::ONNXModelEditor::set_tensor_name(const std::string& current_name, const std::string& new_name) {
     OPENVINO_ASSERT(!new_name.empty(), "New name must not be empty.");
 
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_model_proto()->mutable_graph();
 
     OPENVINO_ASSERT(!(find_graph_input(*graph, new_name) || find_graph_output(*graph, new_name) ||
                       find_graph_initializer(*graph, new_name) || find_graph_value_info(*graph, new_name) ||
@@ -516,7 +526,7 @@ void onnx_editor::ONNXModelEditor::set_tensor_name(const std::string& current_na
 
 void onnx_editor::ONNXModelEditor::set_node_name(const EditorNode& node, const std::string& new_name) {
     const auto node_idx = m_pimpl->m_edge_mapper.get_node_index(node);
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_model_proto()->mutable_graph();
 
     m_pimpl->m_is_mapper_updated = false;
 
@@ -536,7 +546,7 @@ std::string onnx_editor::ONNXModelEditor::get_node_name(const EditorNode& node)
 }
 
 void onnx_editor::ONNXModelEditor::clear_nodes_name(const std::string& name) {
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_model_proto()->mutable_graph();
 
     m_pimpl->m_is_mapper_updated = false;
 
@@ -552,7 +562,7 @@ void onnx_editor::ONNXModelEditor::set_name_for_dimension(const std::string& nod
                                                           const std::string& dim_name) {
     OPENVINO_ASSERT(!dim_name.empty(), "Dimension name must not be empty.");
 
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_model_proto()->mutable_graph();
 
     OPENVINO_ASSERT(!find_graph_initializer(*graph, node_name), "ONNX initializer shape dimension cannot be dynamic.");
 
@@ -639,7 +649,7 @@ std::shared_ptr<Model> onnx_editor::ONNXModelEditor::decode() {
 }
 
 void onnx_editor::ONNXModelEditor::add_output(const OutputEdge& output_edge) const {
-    auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto onnx_graph = m_pimpl->mutable_model_proto()->mutable_graph();
     std::vector<onnx_editor::OutputEdge> onnx_output;
     onnx_output.push_back(output_edge);
     SubgraphExtractor editor{*onnx_graph};
@@ -4,12 +4,15 @@
 
 #include "utils/tensor_external_data.hpp"
 
-#include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
+#include "mmap_object.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 
 namespace ngraph {
@@ -28,43 +31,59 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
     }
 }
 
-std::string TensorExternalData::load_external_data() const {
-    NGRAPH_SUPPRESS_DEPRECATED_START
+std::shared_ptr<ngraph::runtime::AlignedBuffer> TensorExternalData::load_external_mmap_data() const {
+    // external files are usually shared by many tensors, so the mappings are reused while any tensor data is alive
+    static std::mutex mapped_files_mutex;
+    static std::map<std::string, std::weak_ptr<ngraph::runtime::AlignedBuffer>> mapped_files;
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> mapped_file;
+    {
+        std::lock_guard<std::mutex> lock{mapped_files_mutex};
+        mapped_file = mapped_files[m_data_location].lock();
+        if (!mapped_file) {
+            try {
+                NGRAPH_SUPPRESS_DEPRECATED_START
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    std::wstring path = ov::util::string_to_wstring(m_data_location);
+                mapped_file = ov::load_mmap_object(ov::util::string_to_wstring(m_data_location));
 #else
-    std::string path = m_data_location;
+                mapped_file = ov::load_mmap_object(m_data_location);
 #endif
-    NGRAPH_SUPPRESS_DEPRECATED_END
-    std::ifstream external_data_stream(path, std::ios::binary | std::ios::in | std::ios::ate);
-    if (external_data_stream.fail())
-        throw error::invalid_external_data{*this};
+                NGRAPH_SUPPRESS_DEPRECATED_END
+            } catch (const ov::Exception&) {
+                throw error::invalid_external_data{*this};
+            }
+            mapped_files[m_data_location] = mapped_file;
+        }
+    }
 
-    std::streamsize read_data_length;
-    if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
-    else
-        read_data_length = m_data_length;
+    const size_t file_size = mapped_file->size();
+    // default value of m_offset is 0, zero m_data_length means the data lasts till the end of file
+    const size_t offset = static_cast<size_t>(m_offset);
+    if (m_offset < 0 || m_data_length < 0 || offset > file_size ||
+        static_cast<size_t>(m_data_length) > file_size - offset)
+        throw error::invalid_external_data{*this};
+    const size_t data_length = m_data_length == 0 ? file_size - offset : static_cast<size_t>(m_data_length);
 
     const auto page_size = 4096;
     if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
+        NGRAPH_WARN << "offset should be multiples 4096 (page size) to keep the mapped data aligned, "
+                       "misaligned data is copied, current value is "
                     << m_offset;
     }
-    // default value of m_offset is 0
-    external_data_stream.seekg(m_offset, std::ios::beg);
 
     if (m_sha1_digest != 0) {
         NGRAPH_WARN << "SHA1 checksum is not supported";
     }
 
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
-    external_data_stream.close();
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+        mapped_file->get_ptr<char>() + offset,
+        data_length,
+        mapped_file);
+}
 
-    return read_data;
+std::string TensorExternalData::load_external_data() const {
+    const auto buffer = load_external_mmap_data();
+    return std::string(buffer->get_ptr<char>(), buffer->size());
 }
 
 std::string TensorExternalData::to_string() const {
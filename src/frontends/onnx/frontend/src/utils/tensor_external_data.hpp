@@ -6,6 +6,8 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
@@ -23,6 +25,16 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       Every external file is mapped once, the mapping is shared by all
+    ///             the tensors referencing the file while any of them is alive.
+    ///             If the file can't be mapped or it's smaller than the data range,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \return     Buffer pointing to the tensor data inside the mapped file
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> load_external_mmap_data() const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -4,12 +4,16 @@
 
 #include "input_model.hpp"
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <queue>
 
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "mmap_object.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
 #include "openvino/util/common_util.hpp"
@@ -60,6 +64,7 @@ private:
     void loadPlaces();
     template <typename T>
     void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadConsts(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights);
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
@@ -164,6 +169,21 @@ bool read_tensor(std::istream& is, char* data, size_t len) {
     return true;
 }
 
+// Returns the data of the tensor which starts at the given offset of the mapped weights file and moves the offset
+// to the next tensor. The layout of the tensor is the same as expected by read_tensor.
+const char* get_mapped_tensor(const ngraph::runtime::AlignedBuffer& weights, size_t& offset, size_t len) {
+    const size_t header_size = 16;
+    uint32_t dims_len = 0;
+    if (weights.size() < offset + header_size + sizeof(dims_len))
+        return nullptr;
+    std::memcpy(&dims_len, weights.get_ptr<char>() + offset + header_size, sizeof(dims_len));
+    const size_t data_offset = offset + header_size + sizeof(dims_len) + dims_len;
+    if (weights.size() < data_offset + len)
+        return nullptr;
+    offset = data_offset + len;
+    return weights.get_ptr<char>() + data_offset;
+}
+
 template <typename T>
 std::basic_string<T> get_const_path(const std::basic_string<T>& folder_with_weights, const std::string& name) {
     return folder_with_weights + paddle::get_path_sep<T>() + name;
@@ -179,16 +199,13 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_file) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -197,16 +214,14 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path,
+                                          std::basic_string<wchar_t>* weights_file) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -300,6 +315,44 @@ void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_w
     }
 }
 
+void InputModel::InputModelImpl::loadConsts(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
+    // Tensors are stored in the weights file one after another in the order of their names
+    size_t offset = 0;
+    for (const auto& item : m_var_places) {
+        const auto& var_desc = item.second->get_desc();
+        const auto& name = item.first;
+        if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
+            continue;
+        if (!var_desc.persistable())
+            continue;
+
+        FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
+        const auto& tensor = var_desc.type().lod_tensor().tensor();
+        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
+        const auto& type = TYPE_MAP[tensor.data_type()];
+        const auto& data_length = shape_size(shape) * type.size();
+
+        const auto data = get_mapped_tensor(*weights, offset, data_length);
+        FRONT_END_GENERAL_CHECK(data, "File containing constant with name ", name, " wasn't successfully read.");
+
+        std::shared_ptr<opset7::Constant> const_node;
+        if (reinterpret_cast<uintptr_t>(data) % type.size() == 0) {
+            // Constant keeps the whole mapped file alive and doesn't copy the data
+            auto buffer =
+                std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                    const_cast<char*>(data),
+                    data_length,
+                    weights);
+            const_node = std::make_shared<opset7::Constant>(type, shape, buffer);
+        } else {
+            // tensor headers have variable length, so the data may be misaligned for its element type
+            const_node = std::make_shared<opset7::Constant>(type, shape, data);
+        }
+        const_node->set_friendly_name(name);
+        m_tensor_values[name] = const_node;
+    }
+}
+
 template <typename T>
 InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
                                            const InputModel& input_model,
@@ -308,8 +361,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
       m_input_model(input_model),
       m_telemetry(telemetry) {
     std::string empty_str;
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_file;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_file), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -322,8 +375,10 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
-    if (weights_stream && weights_stream.is_open()) {
-        loadConsts(std::basic_string<T>{}, &weights_stream);
+    // Don't throw error if weights file doesn't exist
+    // It may mean that model don't have constants
+    if (!weights_file.empty() && std::ifstream(weights_file).is_open()) {
+        loadConsts(ov::load_mmap_object(weights_file));
     } else {
         loadConsts(path, nullptr);
     }
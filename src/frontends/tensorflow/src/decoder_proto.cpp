@@ -167,11 +167,20 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
+const ::tensorflow::TensorProto* DecoderProto::get_tensor_attribute(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    auto it = attr_map.find(name);
+    if (it == attr_map.end() || it->second.value_case() != ::tensorflow::AttrValue::ValueCase::kTensor) {
+        return nullptr;
+    }
+    return &it->second.tensor();
+}
+
 std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
+    const auto& attr_map = m_node_def->attr();
+    auto it = attr_map.find(name);
+    if (it != attr_map.end()) {
+        return {it->second};
     } else {
         return {};
     }
@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "attr_value.pb.h"
+#include "graph.pb.h"
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/decoder.hpp"
 #include "types.pb.h"
@@ -18,7 +20,10 @@ namespace tensorflow {
 
 class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
-    explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
+    explicit DecoderProto(const ::tensorflow::NodeDef* node_def,
+                          const std::shared_ptr<::tensorflow::GraphDef>& graph_def = nullptr)
+        : m_node_def(node_def),
+          m_graph_def(graph_def) {}
 
     ov::Any get_attribute(const std::string& name) const override;
 
@@ -34,9 +39,18 @@ public:
 
     const std::string& get_op_name() const override;
 
+    /// \brief Returns tensor attribute without copying it or nullptr if the node has no such tensor attribute
+    const ::tensorflow::TensorProto* get_tensor_attribute(const std::string& name) const;
+
+    /// \brief Returns GraphDef owning the node, it is empty if the lifetime of the node is managed by the caller
+    const std::shared_ptr<::tensorflow::GraphDef>& get_graph_def() const {
+        return m_graph_def;
+    }
+
 private:
     std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
 };
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,6 +4,8 @@
 
 #include "openvino/frontend/tensorflow/frontend.hpp"
 
+#include <ie_parallel.hpp>
+
 #include "input_model.hpp"
 #include "op_table.hpp"
 #include "openvino/frontend/tensorflow/extension/conversion.hpp"
@@ -96,14 +98,46 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         ng_op_map[input_name] = {param};
     }
 
+    // Const operations have no data inputs and usually hold most of the model size, so they are translated
+    // in parallel before other operations unless the translator is overridden by a conversion extension.
+    // Constants which failed to translate are handled again in the regular order below
+    std::vector<ov::OutputVector> const_outputs(operation_places.size());
+    const bool const_translator_overridden =
+        std::any_of(m_conversion_extensions.begin(),
+                    m_conversion_extensions.end(),
+                    [](const ConversionExtensionBase::Ptr& extension) {
+                        return extension->get_op_type() == "Const";
+                    });
+    if (!no_conversion && !const_translator_overridden) {
+        const auto& const_translator = translate_map.at("Const");
+        InferenceEngine::parallel_for(operation_places.size(), [&](size_t idx) {
+            const auto& operation_place = operation_places[idx];
+            auto operation_decoder = operation_place->get_decoder();
+            if (operation_decoder->get_op_type() != "Const" || ng_op_map.count(operation_place->get_names()[0])) {
+                return;
+            }
+            try {
+                NodeContext node_context(*operation_decoder, {});
+                const_outputs[idx] = const_translator(node_context);
+            } catch (...) {
+                const_outputs[idx].clear();
+            }
+        });
+    }
+
     // create the OV ops from TensorFlow ops
-    for (const auto& operation_place : operation_places) {
+    for (size_t operation_idx = 0; operation_idx < operation_places.size(); ++operation_idx) {
+        const auto& operation_place = operation_places[operation_idx];
         auto operation_decoder = operation_place->get_decoder();
         auto operation_name = operation_place->get_names()[0];
         // output for parameter nodes has been already generated
         if (ng_op_map.count(operation_name)) {
             continue;
         }
+        if (!const_outputs[operation_idx].empty()) {
+            ng_op_map[operation_name] = std::move(const_outputs[operation_idx]);
+            continue;
+        }
 
         // prepare a list of OV node inputs for each node
         ov::OutputVector ng_inputs;
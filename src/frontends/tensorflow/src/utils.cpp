@@ -4,6 +4,8 @@
 
 #include "utils.hpp"
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 void ov::frontend::tensorflow::tf_shape_to_ov_shape(const ::tensorflow::TensorShapeProto& tf_shape,
                                                     ov::PartialShape* ng_shape) {
     std::vector<ov::Dimension> dims;
@@ -27,3 +29,34 @@ void ov::frontend::tensorflow::set_node_name(const std::string& node_name, const
 void ov::frontend::tensorflow::set_out_name(const std::string& out_name, const ov::Output<ov::Node>& output) {
     output.get_tensor().add_names({out_name});
 }
+
+std::shared_ptr<ov::opset8::Constant> ov::frontend::tensorflow::make_shared_const_op(const NodeContext& node,
+                                                                                     element::Type et) {
+    const auto* decoder = dynamic_cast<const DecoderProto*>(node.get_decoder());
+    if (!decoder || !decoder->get_graph_def()) {
+        return nullptr;
+    }
+    const auto* tensor_proto = decoder->get_tensor_attribute("value");
+    if (!tensor_proto || tensor_proto->tensor_content().empty() || !tensor_proto->has_tensor_shape()) {
+        return nullptr;
+    }
+
+    ov::PartialShape pshape;
+    tf_shape_to_ov_shape(tensor_proto->tensor_shape(), &pshape);
+    if (pshape.is_dynamic()) {
+        return nullptr;
+    }
+    const auto shape = pshape.get_shape();
+    const auto& tensor_content = tensor_proto->tensor_content();
+    const auto address = reinterpret_cast<uintptr_t>(tensor_content.data());
+    if (tensor_content.size() != shape_size(shape) * et.size() || address % et.size() != 0) {
+        return nullptr;
+    }
+
+    // GraphDef owns the tensor content, so it is kept alive while the Constant exists
+    using SharedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<::tensorflow::GraphDef>>;
+    auto buffer = std::make_shared<SharedBuffer>(const_cast<char*>(tensor_content.data()),
+                                                 tensor_content.size(),
+                                                 decoder->get_graph_def());
+    return std::make_shared<ov::opset8::Constant>(et, shape, buffer);
+}
@@ -71,6 +71,10 @@ void make_padding(const std::string& tf_padding_type,
 
 void tf_shape_to_ov_shape(const ::tensorflow::TensorShapeProto& tf_shape, ov::PartialShape* ng_shape);
 
+/// \brief Creates Constant which data points to tensor content of the parsed GraphDef, so the weights are not copied.
+/// \return nullptr if the node is not decoded from GraphDef or its tensor content cannot be shared
+std::shared_ptr<ov::opset8::Constant> make_shared_const_op(const NodeContext& node, element::Type et);
+
 template <typename T>
 void get_const_input(const NodeContext& node, int64_t input_index, std::vector<T>* vector) {
     auto ng_input = node.get_input(input_index);
@@ -106,16 +110,15 @@ void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_sha
     tf_shape_to_ov_shape(shape, &pshape);
     *const_tensor_shape = pshape.get_shape();
     TENSORFLOW_OP_VALIDATION(node, pshape.is_static(), "Dynamic shapes are not supported in Constant conversion.");
-    auto tensor_content = tensor_proto.tensor_content();
-    std::vector<char> tensor_values_plain(tensor_content.begin(), tensor_content.end());
-    const T* tensor_values = reinterpret_cast<const T*>(tensor_values_plain.data());
+    const auto& tensor_content = tensor_proto.tensor_content();
+    const T* tensor_values = reinterpret_cast<const T*>(tensor_content.data());
 
-    if (!tensor_values_plain.empty() && tensor_proto.has_tensor_shape()) {
+    if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
         // When tensor_shape is set, theoretically the representation of the data
         // could be compressed. So, before copying values to the returned vector,
         // make sure no compression happens.
-        // if (shape.dim_size() == 1 && shape.dim(0).size() == tensor_values_plain.size()/sizeof(T)) {
-        values->insert(values->end(), tensor_values, tensor_values + tensor_values_plain.size() / sizeof(T));
+        // if (shape.dim_size() == 1 && shape.dim(0).size() == tensor_content.size()/sizeof(T)) {
+        values->insert(values->end(), tensor_values, tensor_values + tensor_content.size() / sizeof(T));
         return;
         //}
     }
@@ -190,6 +193,11 @@ void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_sha
 
 template <typename T, typename VecT = T>
 void make_const_op(const NodeContext& node, element::Type et, ov::Output<ov::Node>& ng_node) {
+    if (auto constant = make_shared_const_op(node, et)) {
+        ng_node = constant;
+        return;
+    }
+
     std::vector<VecT> const_values;
     ov::Shape ng_shape;
 
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov::frontend;
+
+TEST(FrontEndConvertModelTest, test_large_const) {
+    std::shared_ptr<ov::Model> model;
+    {
+        FrontEndManager fem;
+        FrontEnd::Ptr frontEnd;
+        InputModel::Ptr inputModel;
+        ASSERT_NO_THROW(frontEnd = fem.load_by_framework(TF_FE));
+        ASSERT_NE(frontEnd, nullptr);
+        auto model_filename = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                                 std::string("large_const/large_const.pb"));
+        ASSERT_NO_THROW(inputModel = frontEnd->load(model_filename));
+        ASSERT_NE(inputModel, nullptr);
+        ASSERT_NO_THROW(model = frontEnd->convert(inputModel));
+        ASSERT_NE(model, nullptr);
+    }
+
+    // constants share the data of the parsed model, it must outlive the frontend and the input model
+    size_t checked = 0;
+    for (const auto& node : model->get_ordered_ops()) {
+        const auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(node);
+        if (!constant || ov::shape_size(constant->get_shape()) != 256 * 1024) {
+            continue;
+        }
+        if (constant->get_element_type() == ov::element::f32) {
+            const auto values = constant->cast_vector<float>();
+            for (size_t i = 0; i < values.size(); ++i) {
+                ASSERT_EQ(values[i], static_cast<float>(i));
+            }
+        } else {
+            ASSERT_EQ(constant->get_element_type(), ov::element::boolean);
+            const auto values = constant->cast_vector<char>();
+            for (size_t i = 0; i < values.size(); ++i) {
+                ASSERT_EQ(values[i] != 0, i % 3 == 0);
+            }
+        }
+        checked++;
+    }
+    ASSERT_EQ(checked, 2);
+}
@@ -0,0 +1,34 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+#
+# tensorflow model with large constants generator
+#
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+
+def main():
+    tf.compat.v1.reset_default_graph()
+
+    # Create the graph and model
+    with tf.compat.v1.Session() as sess:
+        input = tf.compat.v1.placeholder(tf.float32, [256, 1024], 'x')
+
+        weights = tf.constant(np.arange(256 * 1024).reshape([256, 1024]), dtype=tf.float32, name="weights")
+        mask = tf.constant(np.arange(256 * 1024).reshape([256, 1024]) % 3 == 0, dtype=tf.bool, name="mask")
+
+        add = tf.add(input, weights, name="add")
+        tf.where(mask, add, input, name="select")
+
+        tf.compat.v1.global_variables_initializer()
+        tf_net = sess.graph_def
+
+    tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "large_const"), "large_const.pb", False)
+
+
+if __name__ == "__main__":
+    main()
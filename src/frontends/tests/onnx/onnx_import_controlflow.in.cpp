@@ -7,6 +7,7 @@
 #include "engines_util/test_engines.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
+#include "ngraph/op/util/multi_subgraph_base.hpp"
 #include "ngraph/type.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_import/onnx.hpp"
@@ -754,6 +755,91 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_if_dynamic_inputs) {
     test_case.run();
 }
 
+namespace {
+// friendly names of the ops which were named explicitly, ops of the bodies follow their multi-subgraph op
+void collect_explicit_names(const std::shared_ptr<Function>& function, std::vector<std::string>& names) {
+    for (const auto& op : function->get_ordered_ops()) {
+        if (op->get_friendly_name() != op->get_name()) {
+            names.push_back(op->get_friendly_name());
+        }
+        if (const auto multi_subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < multi_subgraph_op->get_internal_subgraphs_size(); ++i) {
+                const auto body = multi_subgraph_op->get_function(static_cast<int>(i));
+                // Results of bodies are created by the If translator after the conversion
+                for (const auto& body_op : body->get_ordered_ops()) {
+                    if (!ov::is_type<default_opset::Result>(body_op)) {
+                        EXPECT_NE(body_op->get_friendly_name(), body_op->get_name())
+                            << "Body op has a name which depends on the conversion order";
+                    }
+                }
+                collect_explicit_names(body, names);
+            }
+        }
+    }
+}
+}  // namespace
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_if_branches_with_initializers_deterministic) {
+    /*
+       a = x + w0 + w1 + w2 + w3 + w4 + w5
+       if (condition) {
+         mul = a * w_then
+         mul + reduce_max(mul, axes=[1])
+       } else {
+         sub = a - w_else
+         sub - reduce_min(sub, axes=[0])
+       }
+    */
+    // initializers and branches are converted concurrently, names must not depend on the scheduling
+    std::vector<std::string> reference_names;
+    for (int i = 0; i < 10; ++i) {
+        const auto function = onnx_import::import_onnx_model(
+            file_util::path_join(SERIALIZED_ZOO, "onnx/controlflow/if_branches_with_initializers.onnx"));
+        std::vector<std::string> names;
+        collect_explicit_names(function, names);
+        if (reference_names.empty()) {
+            reference_names = names;
+            for (const auto& initializer : {"w0", "w1", "w2", "w3", "w4", "w5", "w_then", "w_else"}) {
+                EXPECT_NE(std::find(names.begin(), names.end(), initializer), names.end())
+                    << "Missing initializer " << initializer;
+            }
+        } else {
+            ASSERT_EQ(names, reference_names);
+        }
+
+        auto test_case = test::TestCase(function, s_device);
+        test_case.add_input<bool>({true});  // condition
+        test_case.add_input<float>({1.f, 1.f, 1.f, 1.f});
+        test_case.add_expected_output<float>(Shape{2, 2}, {40.f, 52.f, 88.f, 100.f});
+        test_case.run();
+
+        test_case.add_input<bool>({false});  // condition
+        test_case.add_input<float>({1.f, 1.f, 1.f, 1.f});
+        test_case.add_expected_output<float>(Shape{2, 2}, {0.f, 0.f, 12.f, 12.f});
+        test_case.run();
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_controlflow_loop_body_keeps_default_names) {
+    // a single body is converted sequentially, so its nodes keep their default names
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/controlflow/loop_concat_values.onnx"));
+
+    size_t default_named_ops = 0;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (const auto loop = ov::as_type_ptr<default_opset::Loop>(op)) {
+            for (const auto& body_op : loop->get_function()->get_ordered_ops()) {
+                EXPECT_EQ(body_op->get_friendly_name().find("/body/"), std::string::npos)
+                    << "Body op " << body_op->get_friendly_name() << " was renamed";
+                if (body_op->get_friendly_name() == body_op->get_name()) {
+                    ++default_named_ops;
+                }
+            }
+        }
+    }
+    EXPECT_GT(default_named_ops, 0);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_if_negative_missing_branches) {
     try {
         const auto function = onnx_import::import_onnx_model(
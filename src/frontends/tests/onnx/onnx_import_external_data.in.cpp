@@ -84,6 +84,44 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_share_mapping) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<default_opset::Constant>(op)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    // both constants reference the single mapping of the external file at their offsets
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(), 4096);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_misaligned_offset_is_copied) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_misaligned_offset.onnx"));
+
+    std::shared_ptr<default_opset::Constant> constant;
+    for (const auto& op : function->get_ops()) {
+        if (const auto c = std::dynamic_pointer_cast<default_opset::Constant>(op)) {
+            constant = c;
+        }
+    }
+    ASSERT_NE(constant, nullptr);
+    // the data starts at offset 1 of the file, so it's copied instead of being shared with the mapping
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % sizeof(float), 0);
+    EXPECT_EQ(constant->cast_vector<float>(), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+
+    auto test_case = test::TestCase(function, s_device);
+    test_case.add_input<float>({1.f, 1.f, 1.f, 1.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {2.f, 3.f, 4.f, 5.f});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -46,6 +46,14 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Index of the NUMA node all CPU Executor Streams are bound to in case of NUMA threads binding.
+ *        Used by HETERO plugin to place pipeline stages of a model on different NUMA nodes. -1 (default) distributes
+ *        the streams between all the NUMA nodes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BIND_NUMA_NODE);
+
 /**
  * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
  * stream
@@ -95,6 +95,8 @@ public:
                                        //!< starting from offset
         int _threads = 0;              //!< Number of threads distributed between streams.
                                        //!< Reserved. Should not be used.
+        int _threadBindingNumaNode = -1;  //!< In case of @ref NUMA binding type all the streams are bound to
+                                          //!< the NUMA node with this index, -1 distributes streams between nodes
         enum PreferredCoreType {
             ANY,
             LITTLE,
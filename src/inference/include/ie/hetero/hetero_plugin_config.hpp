@@ -15,6 +15,24 @@
 
 namespace InferenceEngine {
 
+namespace Metrics {
+
+/**
+ * @def HETERO_METRIC_KEY(name)
+ * @brief Shortcut for defining HETERO executable network metrics
+ */
+#define HETERO_METRIC_KEY(name)              METRIC_KEY(HETERO_##name)
+#define DECLARE_HETERO_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(HETERO_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric of an executable network with statistics of its subnetworks, which are executed as pipeline stages:
+ * "stage<N>.inferences", "stage<N>.busy_us" (total execution time in microseconds) and "stage<N>.utilization_percent"
+ * (share of the time since the first inference of the stage it was executing)
+ */
+DECLARE_HETERO_METRIC_KEY(STAGES_STATISTICS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
+
 /**
  * @brief Heterogeneous plugin configuration
  */
@@ -34,5 +52,14 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for splitting of a network placed on CPU into the given number of pipeline stages with about the
+ * same amount of weights and activations. Each stage is a CPU executable network bound to its own NUMA node (stage
+ * index modulo the number of NUMA nodes), so weights of a stage stay node-local, while concurrent infer requests flow
+ * through the stages in a pipelined fashion.
+ * This option should be used with positive integer values, 1 (default) disables the splitting
+ */
+DECLARE_HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
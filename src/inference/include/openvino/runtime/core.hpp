@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -16,6 +17,7 @@
 #include <vector>
 
 #include "ie_plugin_config.hpp"
+#include "openvino/core/compilation_monitor.hpp"
 #include "openvino/core/extension.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/op_extension.hpp"
@@ -256,6 +258,47 @@ public:
         return compile_model(model_path, device_name, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Creates a compiled model from a source model object without blocking the calling thread.
+     *
+     * The model is compiled in a separate thread. The monitor is notified about the stages of the compilation
+     * and allows to cancel it. A cancelled compilation stops at the nearest check point, e.g. before the next
+     * transformation, and the future throws ov::Cancelled.
+     *
+     * @note As for any future created by std::async, the destructor of the returned future waits for the
+     * compilation to finish. Cancel the monitor to abandon the compilation.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param monitor Optional monitor of the compilation.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future of the compiled model.
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const std::shared_ptr<CompilationMonitor>& monitor = nullptr,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Reads a model and creates a compiled model from the IR/ONNX/PDPD file without blocking the calling
+     * thread.
+     *
+     * Reading of the model is a part of the compilation, so it is also reported to the monitor and can be
+     * cancelled. See Core::compile_model_async(const std::shared_ptr<const ov::Model>&, ...) for details.
+     *
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param monitor Optional monitor of the compilation.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future of the compiled model.
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const std::shared_ptr<CompilationMonitor>& monitor = nullptr,
+                                                   const AnyMap& properties = {});
+
     /**
      * @brief Creates a compiled model from a source model within a specified remote context.
      * @param model Model object acquired from Core::read_model.
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include <openvino/runtime/properties.hpp>
 #include <string>
 
@@ -18,5 +19,60 @@ namespace intel_auto {
  */
 static constexpr Property<bool> device_bind_buffer{"DEVICE_BIND_BUFFER"};
 
+/**
+ * @brief auto device setting that keeps the CPU helper network for the given number of milliseconds after
+ * the last request it took over from the overloaded accelerator, 0 releases the helper right after the handoff
+ */
+static constexpr Property<uint32_t> cpu_help_release_delay{"CPU_HELP_RELEASE_DELAY"};
+
+/**
+ * @brief Enum to define the policy MULTI uses to dispatch infer requests to the devices
+ */
+enum class SchedulePolicy {
+    DEVICE_PRIORITY = 0,   //!<  The first device in the priority list with an idle infer request is used
+    LATENCY_BALANCED = 1,  //!<  The device with the lowest expected completion time is used
+    DEFAULT = DEVICE_PRIORITY,
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy) {
+    switch (policy) {
+    case SchedulePolicy::DEVICE_PRIORITY:
+        return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::LATENCY_BALANCED:
+        return os << "LATENCY_BALANCED";
+    default:
+        throw ov::Exception{"Unsupported schedule policy"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "DEVICE_PRIORITY") {
+        policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "LATENCY_BALANCED") {
+        policy = SchedulePolicy::LATENCY_BALANCED;
+    } else {
+        throw ov::Exception{"Unsupported schedule policy: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief multi device setting that selects how infer requests are dispatched to the devices
+ */
+static constexpr Property<SchedulePolicy> schedule_policy{"SCHEDULE_POLICY"};
+
+/**
+ * @brief Read-only property with the per-device statistics collected by the multi device scheduler.
+ * The keys are "<device>.inferences", "<device>.in_flight", "<device>.latency_us" (moving average) and
+ * "<device>.service_us" (moving average of the latency divided by the number of requests sharing the device).
+ * The latency balanced policy expects a new request to complete in service_us * (in_flight + 1).
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> device_statistics{
+    "DEVICE_STATISTICS"};
+
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
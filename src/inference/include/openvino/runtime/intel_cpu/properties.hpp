@@ -0,0 +1,156 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in set_property, compile_model, import_model, get_property methods
+ *
+ * @file openvino/runtime/intel_cpu/properties.hpp
+ */
+#pragma once
+
+#include <openvino/runtime/properties.hpp>
+#include <string>
+
+namespace ov {
+
+/**
+ * @brief Namespace with Intel CPU specific properties
+ */
+namespace intel_cpu {
+
+/**
+ * @brief Static input shapes for which a model with dynamic inputs gets specialized static graphs.
+ * Buckets are separated by ';', each bucket lists shapes of all model inputs in parameters order,
+ * e.g. "[1,128],[1,128];[1,256],[1,256]". Inference requests with input shapes equal to one of the
+ * buckets are executed by the corresponding static graph, all others use the dynamic one.
+ */
+static constexpr Property<std::string> shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief Read-only compiled model property with the number of inferences executed by each shape bucket.
+ * Inferences which don't match any bucket are counted under the "dynamic" key.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> shape_buckets_statistics{
+    "CPU_SHAPE_BUCKETS_STATISTICS"};
+
+/**
+ * @brief Enables sampled per node profiling: every N-th inference of each stream records wall time, bytes of
+ * input and output tensors and the selected primitive implementation of every executed node. 0 disables sampling.
+ * Unlike ov::enable_profiling it can be changed on a compiled model at any time.
+ */
+static constexpr Property<uint32_t> perf_sampling_rate{"CPU_PERF_SAMPLING_RATE"};
+
+/**
+ * @brief Read-only compiled model property with the most recent per node samples, oldest first,
+ * one "infer_id,node,layer_type,exec_type,real_time_ns,bytes,start_ns" CSV line per sample, string fields are quoted
+ * (RFC 4180). start_ns is the time from the start of the inference to the start of the node.
+ * Only a limited number of the latest samples is kept.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> perf_samples{"CPU_PERF_SAMPLES"};
+
+/**
+ * @brief Enables collection of per transformation statistics during model compilation,
+ * the report is available via ov::intel_cpu::transformations_profile of the compiled model.
+ */
+static constexpr Property<bool> profile_transformations{"CPU_PROFILE_TRANSFORMATIONS"};
+
+/**
+ * @brief Read-only compiled model property with the JSON report of transformations executed during compilation:
+ * wall time, validation time, matcher callbacks attempted and succeeded, nodes added and removed per pass.
+ * Passes of nested managers are reported with '/' separated names. Empty if ov::intel_cpu::profile_transformations
+ * was not enabled.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> transformations_profile{"CPU_TRANSFORMATIONS_PROFILE"};
+
+/**
+ * @brief Enum to define the allocator of graph intermediate buffers, weights cache and infer request tensors
+ */
+enum class MemoryAllocator {
+    DEFAULT = 0,                 //!< Aligned heap allocation
+    TRANSPARENT_HUGE_PAGES = 1,  //!< Buffers of 2 MB and larger are 2 MB aligned and advised to use transparent huge pages
+    HUGE_PAGES = 2,  //!< Buffers of 2 MB and larger are mapped from the reserved huge pages pool, transparent huge
+                     //!< pages are used if the pool is exhausted
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemoryAllocator& allocator) {
+    switch (allocator) {
+    case MemoryAllocator::DEFAULT:
+        return os << "DEFAULT";
+    case MemoryAllocator::TRANSPARENT_HUGE_PAGES:
+        return os << "TRANSPARENT_HUGE_PAGES";
+    case MemoryAllocator::HUGE_PAGES:
+        return os << "HUGE_PAGES";
+    default:
+        throw ov::Exception{"Unsupported memory allocator"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemoryAllocator& allocator) {
+    std::string str;
+    is >> str;
+    if (str == "DEFAULT") {
+        allocator = MemoryAllocator::DEFAULT;
+    } else if (str == "TRANSPARENT_HUGE_PAGES") {
+        allocator = MemoryAllocator::TRANSPARENT_HUGE_PAGES;
+    } else if (str == "HUGE_PAGES") {
+        allocator = MemoryAllocator::HUGE_PAGES;
+    } else {
+        throw ov::Exception{"Unsupported memory allocator: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Allocator of graph intermediate buffers, weights cache and infer request tensors.
+ * Huge pages are supported on Linux only, other platforms use the default allocator.
+ */
+static constexpr Property<MemoryAllocator> memory_allocator{"CPU_MEMORY_ALLOCATOR"};
+
+/**
+ * @brief Enables selection of primitive implementations by their execution time measured on the real shapes during
+ * model compilation. The fastest implementations are stored in ov::cache_dir, if it is set, and reused by later
+ * compilations of the same model on hosts with the same instruction set.
+ */
+static constexpr Property<bool> primitives_autotuning{"CPU_PRIMITIVES_AUTOTUNING"};
+
+/**
+ * @brief Enables depth-first execution of chains of convolutions, poolings and element-wise operations on 4D tensors
+ * with static shapes: a chain is split into bands of rows, which are executed one after another through the whole chain,
+ * so the intermediate tensors of a band stay in the L2 cache. Beneficial for CNNs with large spatial inputs.
+ */
+static constexpr Property<bool> depth_first_tiling{"CPU_DEPTH_FIRST_TILING"};
+
+/**
+ * @brief Number of core groups a single inference of a stream is distributed over. Independent branches of the graph
+ * are executed concurrently, each group on its own share of the stream threads, which reduces the latency of models
+ * whose nodes are too small to load all the cores. 1 (default) executes the graph node by node. Applies to models
+ * with static shapes compiled with a single stream only, otherwise the value is reset to 1.
+ */
+static constexpr Property<uint32_t> intra_request_streams{"CPU_INTRA_REQUEST_STREAMS"};
+
+/**
+ * @brief Enables the graph wide layout assignment: after primitive descriptors are selected node by node, nodes are
+ * switched to other supported descriptors if it decreases the estimated cost of reorders and implementations around
+ * them. Disabled by default.
+ */
+static constexpr Property<bool> layout_assignment{"CPU_LAYOUT_ASSIGNMENT"};
+
+/**
+ * @brief Enables the fusion of scaled dot product attention (MatMul, optional scale and mask, Softmax, MatMul) into
+ * a single node which does not store the matrix of scores. Applied on CPUs with AVX2 only. Disabled by default.
+ */
+static constexpr Property<bool> mha_fusion{"CPU_MHA_FUSION"};
+
+/**
+ * @brief Read-only compiled model property with the JSON report of reorders in the graph: reorders and reordered
+ * elements estimated for layouts selected node by node ("greedy_*") and after the graph wide layout assignment
+ * ("optimized_*"), and the number of reorders inserted into the graph ("inserted_reorders").
+ */
+static constexpr Property<std::string, PropertyMutability::RO> reorders_report{"CPU_REORDERS_REPORT"};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -34,11 +34,13 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/pass/constant_folding.hpp"
+#include "openvino/core/compilation_monitor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
+#include "openvino/runtime/exception.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/shared_object.hpp"
@@ -561,6 +563,9 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
+        if (auto monitor = ov::CompilationMonitor::get_current()) {
+            monitor->report(ov::CompilationStage::READ_MODEL);
+        }
         return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
     }
 
@@ -1768,6 +1773,20 @@ namespace ov {
         OPENVINO_ASSERT(false, "Unexpected exception"); \
     }
 
+// compilation stopped by the monitor fails with whatever exception was thrown at the check point,
+// it is reported as ov::Cancelled regardless of how plugins wrap it, other exceptions keep their type
+#define OV_CORE_COMPILATION_STATEMENT(monitor, ...)                \
+    try {                                                          \
+        __VA_ARGS__;                                               \
+    } catch (const std::exception&) {                              \
+        if (monitor && monitor->is_cancelled()) {                  \
+            throw ov::Cancelled("Model compilation is cancelled"); \
+        }                                                          \
+        throw;                                                     \
+    } catch (...) {                                                \
+        OPENVINO_ASSERT(false, "Unexpected exception");            \
+    }
+
 class Core::Impl : public CoreImpl {
 public:
     Impl() : ov::CoreImpl(true) {}
@@ -1848,6 +1867,36 @@ CompiledModel Core::compile_model(const std::string& modelPath, const std::strin
     });
 }
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                const std::string& deviceName,
+                                                const std::shared_ptr<CompilationMonitor>& monitor,
+                                                const AnyMap& config) {
+    auto impl = _impl;
+    auto properties = any_copy(flatten_sub_properties(deviceName, config));
+    return std::async(std::launch::async, [=]() -> CompiledModel {
+        CompilationMonitor::Scope scope{monitor};
+        OV_CORE_COMPILATION_STATEMENT(monitor, {
+            auto exec = impl->LoadNetwork(toCNN(model), deviceName, properties);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& modelPath,
+                                                const std::string& deviceName,
+                                                const std::shared_ptr<CompilationMonitor>& monitor,
+                                                const AnyMap& config) {
+    auto impl = _impl;
+    auto properties = any_copy(flatten_sub_properties(deviceName, config));
+    return std::async(std::launch::async, [=]() -> CompiledModel {
+        CompilationMonitor::Scope scope{monitor};
+        OV_CORE_COMPILATION_STATEMENT(monitor, {
+            auto exec = impl->LoadNetwork(modelPath, deviceName, properties);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
 CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
                                   const RemoteContext& context,
                                   const AnyMap& config) {
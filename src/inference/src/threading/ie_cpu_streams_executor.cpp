@@ -17,6 +17,7 @@
 #include <utility>
 #include <vector>
 
+#include "ie_itt.hpp"
 #include "ie_parallel_custom_arena.hpp"
 #include "ie_system_conf.h"
 #include "threading/ie_executor_manager.hpp"
@@ -188,7 +189,9 @@ struct CPUStreamsExecutor::Impl {
           }) {
         _exectorMgr = executorManager();
         auto numaNodes = getAvailableNUMANodes();
-        if (_config._streams != 0) {
+        if (ThreadBindingType::NUMA == _config._threadBindingType && _config._threadBindingNumaNode >= 0) {
+            _usedNumaNodes = {numaNodes.at(_config._threadBindingNumaNode)};
+        } else if (_config._streams != 0) {
             std::copy_n(std::begin(numaNodes),
                         std::min(static_cast<std::size_t>(_config._streams), numaNodes.size()),
                         std::back_inserter(_usedNumaNodes));
@@ -249,6 +252,7 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Execute(const Task& task, Stream& stream) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CPUStreamsExecutor::Execute");
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
         if (nullptr != arena) {
@@ -27,6 +27,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_BIND_NUMA_NODE),
         ov::num_streams.name(),
         ov::inference_num_threads.name(),
         ov::affinity.name(),
@@ -150,6 +151,19 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_BIND_NUMA_NODE)) {
+        int val_i;
+        try {
+            val_i = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_BIND_NUMA_NODE)
+                       << ". Expected only integer numbers (NUMA node index or -1)";
+        }
+        if (val_i < -1 || val_i >= static_cast<int>(getAvailableNUMANodes().size())) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_BIND_NUMA_NODE)
+                       << ". Expected index of an available NUMA node or -1";
+        }
+        _threadBindingNumaNode = val_i;
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -188,6 +202,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) const {
         return decltype(ov::inference_num_threads)::value_type{_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_BIND_NUMA_NODE)) {
+        return {std::to_string(_threadBindingNumaNode)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -243,8 +259,13 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
                              //      big-cores only, but the #cores is "enough" (pls see the logic above)
                              // it is usually beneficial not to use the hyper-threading (which is default)
                              : num_cores_default;
+    // streams bound to a single NUMA node share the cores of the node only
+    const auto nodeCores = ThreadBindingType::NUMA == streamExecutorConfig._threadBindingType &&
+                                   streamExecutorConfig._threadBindingNumaNode >= 0
+                               ? std::max(1, hwCores / numaNodesNum)
+                               : hwCores;
     const auto threads =
-        streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
+        streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : nodeCores);
     streamExecutorConfig._threadsPerStream =
         streamExecutorConfig._streams ? std::max(1, threads / streamExecutorConfig._streams) : threads;
     return streamExecutorConfig;
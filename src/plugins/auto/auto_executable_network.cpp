@@ -44,11 +44,14 @@ IE::Parameter AutoExecutableNetwork::GetMetric(const std::string& name) const {
             ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::hint::model_priority.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RO}
+            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::intel_auto::cpu_help_release_delay.name(), ov::PropertyMutability::RO}
         };
     } else if (name == ov::device::priorities) {
         auto value = _autoSContext->_config.find(ov::device::priorities.name());
         return decltype(ov::device::priorities)::value_type {value->second.as<std::string>()};
+    } else if (name == ov::intel_auto::cpu_help_release_delay) {
+        return decltype(ov::intel_auto::cpu_help_release_delay)::value_type {_autoSContext->_cpuHelpReleaseDelay};
     } else if (name == ov::hint::model_priority) {
         auto value = _autoSContext->_modelPriority;
         if (_autoSContext->_core->isNewAPI()) {
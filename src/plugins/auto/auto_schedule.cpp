@@ -217,6 +217,19 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
                     contextPtr->isAlready = true;
                     auto& deviceName = contextPtr->deviceInfo.deviceName;
                     LOG_INFO_TAG("device:%s loading Network finished", deviceName.c_str());
+                    if (contextPtr == &_loadContext[ACTUALDEVICE] && _loadContext[CPU].isEnabled) {
+                        _cpuHelpLastFallbackTime = std::chrono::steady_clock::now();
+                        _cpuHelpFallback = _autoSContext->_cpuHelpReleaseDelay > 0 && _loadContext[CPU].isAlready;
+                        // hand the requests queued behind the busy helper over to the accelerator right away,
+                        // rather than on the next completion of a helper request. A task which finds no idle
+                        // request is pushed back to the tail of the queue, so it may be executed after the tasks
+                        // queued behind it; draining stops there and the rest is scheduled on completions
+                        IE::Task t;
+                        while (_inferPipelineTasks.try_pop(t)) {
+                            if (!ScheduleToWorkerInferRequest(std::move(t)))
+                                break;
+                        }
+                    }
                     if (!isCumulative) {
                         auto supported_config_keys =
                             _autoSContext->_core->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS))
@@ -269,20 +282,36 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
         _executor->run(_loadContext[ACTUALDEVICE].task);
         auto recycleTask = [this]() mutable {
             WaitActualNetworkReady();
-            while (!_exitFlag && _loadContext[ACTUALDEVICE].isAlready) {
-                // handle the case of ACTUAL faster than CPU
-                _loadContext[CPU].future.wait();
-                // clean up helper infer requests
+            if (_exitFlag || !_loadContext[ACTUALDEVICE].isAlready) {
+                return;
+            }
+            // handle the case of ACTUAL faster than CPU
+            _loadContext[CPU].future.wait();
+            if (_cpuHelpFallback) {
+                // keep the helper while the accelerator can't absorb the load on its own
+                const std::chrono::milliseconds delay{_autoSContext->_cpuHelpReleaseDelay};
+                std::unique_lock<std::mutex> lock(_recycleMutex);
+                while (!_exitFlag) {
+                    const auto sinceFallback = std::chrono::steady_clock::now() - _cpuHelpLastFallbackTime.load();
+                    if (sinceFallback >= delay) {
+                        break;
+                    }
+                    _recycleCond.wait_for(lock, delay - sinceFallback);
+                }
+                _cpuHelpFallback = false;
+            }
+            // clean up helper infer requests, the ones taken from the idle queue are counted across the attempts
+            size_t destroynum = 0;
+            std::pair<int, WorkerInferRequest*> worker;
+            std::list<Time> cpuHelpAllStartTimes;
+            std::list<Time> cpuHelpAllEndTimes;
+            while (!_exitFlag) {
                 // first, wait for all the remaining requests to finish
                 for (auto& iter : _workerRequests["CPU_HELP"]) {
                     iter._inferRequest._ptr->Wait(IE::InferRequest::WaitMode::RESULT_READY);
                 }
                 // late enough to check the idle queue now
                 // second, check the idle queue if all requests are in place
-                size_t destroynum = 0;
-                std::pair<int, WorkerInferRequest*> worker;
-                std::list<Time> cpuHelpAllStartTimes;
-                std::list<Time> cpuHelpAllEndTimes;
                 while (_idleWorkerRequests["CPU_HELP"].try_pop(worker)) {
                     destroynum++;
                     INFO_RUN([&cpuHelpAllStartTimes, &cpuHelpAllEndTimes, &worker]() {
@@ -290,13 +319,13 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
                         cpuHelpAllEndTimes.splice(cpuHelpAllEndTimes.end(), worker.second->_endTimes);
                     });
                 }
-                INFO_RUN([this, &cpuHelpAllStartTimes, &cpuHelpAllEndTimes]() {
-                    cpuHelpAllStartTimes.sort(std::less<Time>());
-                    cpuHelpAllEndTimes.sort(std::less<Time>());
-                    _cpuHelpInferCount = cpuHelpAllStartTimes.size();
-                    IE_ASSERT(_cpuHelpInferCount == cpuHelpAllEndTimes.size());
-                });
                 if (destroynum == _workerRequests["CPU_HELP"].size()) {
+                    INFO_RUN([this, &cpuHelpAllStartTimes, &cpuHelpAllEndTimes]() {
+                        cpuHelpAllStartTimes.sort(std::less<Time>());
+                        cpuHelpAllEndTimes.sort(std::less<Time>());
+                        _cpuHelpInferCount = cpuHelpAllStartTimes.size();
+                        IE_ASSERT(_cpuHelpInferCount == cpuHelpAllEndTimes.size());
+                    });
                     std::lock_guard<std::mutex> lock(_autoSContext->_confMutex);
                     INFO_RUN([this, &cpuHelpAllStartTimes, &cpuHelpAllEndTimes, &destroynum]() {
                         _cpuHelpReleaseTime = std::chrono::steady_clock::now();
@@ -316,6 +345,7 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
                     LOG_INFO_TAG("helper released!!");
                     break;
                 }
+                std::this_thread::yield();
             }
         };
         _executor->run(std::move(recycleTask));
@@ -480,6 +510,12 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
         // _acceleratorDevice could be the same as _cpuDevice, such as AUTO:CPU
         if (_loadContext[ACTUALDEVICE].isAlready) {
             devices.push_back(_loadContext[ACTUALDEVICE].deviceInfo);
+            // while the helper is kept, it takes the requests the accelerator has no idle request for
+            if (_cpuHelpFallback) {
+                auto deviceInfo = _loadContext[CPU].deviceInfo;
+                deviceInfo.deviceName = _loadContext[CPU].workName;
+                devices.push_back(std::move(deviceInfo));
+            }
         } else {
             // replace deviceName with workName, so schedule can select correct
             // idleWorkerQueue
@@ -493,6 +529,9 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
             continue;
         }
         if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+            if (&device != &devices.front()) {
+                _cpuHelpLastFallbackTime = std::chrono::steady_clock::now();
+            }
             return true;
         }
     }
@@ -527,7 +566,11 @@ bool AutoSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
 AutoSchedule::~AutoSchedule() {
     // this is necessary to guarantee member destroyed after getting future
     if (_loadContext[CPU].isEnabled) {
-        _exitFlag = true;
+        {
+            std::lock_guard<std::mutex> lock(_recycleMutex);
+            _exitFlag = true;
+        }
+        _recycleCond.notify_all();
         _loadContext[CPU].future.wait();
         WaitActualNetworkReady();
         // it's necessary to wait the loading network threads to stop here.
@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <condition_variable>
+
 #include "multi_schedule.hpp"
 
 #ifdef  MULTIUNITTEST
@@ -65,7 +67,12 @@ private:
     std::once_flag                           _firstLoadOC;
     std::future<void>                        _firstLoadFuture;
     std::promise<void>                       _firstLoadPromise;
-    bool                                     _exitFlag = {false};
+    std::atomic<bool>                        _exitFlag = {false};
+    // after the handoff the requests the accelerator can't take right away are served by CPU_HELP
+    std::atomic<bool>                        _cpuHelpFallback = {false};
+    std::atomic<Time>                        _cpuHelpLastFallbackTime;
+    std::mutex                               _recycleMutex;
+    std::condition_variable                  _recycleCond;
     unsigned int                             _cpuHelpInferCount = 0;
     std::atomic_size_t                       _numRequestsCreated = {0};
     AutoScheduleContext::Ptr                 _autoSContext;
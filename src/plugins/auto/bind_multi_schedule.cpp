@@ -122,6 +122,8 @@ bool BinderMultiSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
         IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, idleWorkerRequests};
         if (_sharedRequest == workerRequestPtr->_inferRequest._ptr.get()) {
             _thisWorkerInferRequest = workerRequestPtr;
+            workerRequestPtr->_scheduledTime = std::chrono::steady_clock::now();
+            workerRequestPtr->_scheduledInFlight = workerRequestPtr->_statistics->Scheduled();
             {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <algorithm>
+#include <limits>
 #include <map>
 #include <string>
 #include "ie_icore.hpp"
@@ -51,6 +53,51 @@ struct DeviceInformation {
     unsigned int devicePriority;
 };
 
+// runtime statistics of a device, used by the latency balanced schedule policy
+struct DeviceStatistics {
+    // weight of the latest sample in the moving averages is 1/2^kLatencyShift
+    static constexpr unsigned int kLatencyShift = 3;
+    // returns the number of requests in flight on the device, the scheduled one included
+    uint64_t Scheduled() {
+        return ++_inFlight;
+    }
+    // inFlight is the value returned by Scheduled() for the completed request
+    void Completed(const Time& scheduledTime, uint64_t inFlight) {
+        const auto sample = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - scheduledTime).count());
+        const bool first = _inferences.load() == 0;
+        Update(_latencyUs, sample, first);
+        // the requests in flight share the device, so the latency of each grows with their number
+        Update(_serviceUs, sample / std::max<uint64_t>(inFlight, 1), first);
+        _inferences++;
+        _inFlight--;
+    }
+    // expected time for a new request to complete on the device: the service time of a request
+    // multiplied by the number of requests which will share the device with the new one
+    double ExpectedCompletionUs() const {
+        if (_inferences.load() == 0) {
+            // a device which was not measured yet gets a single request to measure it
+            return _inFlight.load() == 0 ? 0.0 : std::numeric_limits<double>::max();
+        }
+        return static_cast<double>(_serviceUs.load()) * static_cast<double>(_inFlight.load() + 1);
+    }
+    std::atomic<uint64_t> _inferences = {0};
+    std::atomic<uint64_t> _inFlight = {0};
+    // moving average of the latency of the requests
+    std::atomic<uint64_t> _latencyUs = {0};
+    // moving average of the latency divided by the number of requests in flight when the request was scheduled
+    std::atomic<uint64_t> _serviceUs = {0};
+
+private:
+    static void Update(std::atomic<uint64_t>& average, uint64_t sample, bool first) {
+        uint64_t value = average.load();
+        uint64_t updated;
+        do {
+            updated = first ? sample : value - (value >> kLatencyShift) + (sample >> kLatencyShift);
+        } while (!average.compare_exchange_weak(value, updated));
+    }
+};
+
 struct WorkerInferRequest {
     SoInfer            _inferRequest;
     IE::Task           _task;
@@ -58,6 +105,9 @@ struct WorkerInferRequest {
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
     int                _index = 0;
+    Time               _scheduledTime;
+    uint64_t           _scheduledInFlight = 0;
+    DeviceStatistics*  _statistics = nullptr;
 };
 
 using NotBusyPriorityWorkerRequests = IE::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
@@ -123,6 +173,9 @@ public:
     bool                                           _needPerfCounters;
     bool                                           _batchingDisabled = {false};
     bool                                           _bindBuffer = false;
+    ov::intel_auto::SchedulePolicy                 _schedulePolicy = ov::intel_auto::SchedulePolicy::DEFAULT;
+    // filled when the workers are generated, read by the device_statistics metric
+    DeviceMap<DeviceStatistics>                    _deviceStatistics;
     virtual ~MultiScheduleContext() = default;
 };
 
@@ -135,6 +188,7 @@ public:
     std::string                 _strDevices;
     unsigned int                _modelPriority = 0;
     std::string                 _performanceHint;
+    uint32_t                    _cpuHelpReleaseDelay = 0;
     std::mutex                  _confMutex;
     MultiDeviceInferencePlugin* _plugin;
     virtual ~AutoScheduleContext() = default;
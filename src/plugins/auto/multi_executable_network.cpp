@@ -99,6 +99,8 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             ov::PropertyName{ov::supported_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::intel_auto::device_statistics.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::intel_auto::schedule_policy.name(), ov::PropertyMutability::RO},
 
             // Configs
             // device priority can be changed on-the-fly in MULTI
@@ -119,6 +121,17 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             }
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type {res};
+    } else if (name == ov::intel_auto::device_statistics) {
+        std::map<std::string, uint64_t> statistics;
+        for (auto&& device : _multiSContext->_deviceStatistics) {
+            statistics[device.first + ".inferences"] = device.second._inferences.load();
+            statistics[device.first + ".in_flight"] = device.second._inFlight.load();
+            statistics[device.first + ".latency_us"] = device.second._latencyUs.load();
+            statistics[device.first + ".service_us"] = device.second._serviceUs.load();
+        }
+        return decltype(ov::intel_auto::device_statistics)::value_type {statistics};
+    } else if (name == ov::intel_auto::schedule_policy) {
+        return decltype(ov::intel_auto::schedule_policy)::value_type {_multiSContext->_schedulePolicy};
     } else if (name == ov::model_name) {
         auto it = _multiSContext->_networksPerDevice.begin();
         IE_ASSERT(it != _multiSContext->_networksPerDevice.end());
@@ -128,10 +141,12 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            ov::intel_auto::device_statistics.name()
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = {IE::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES};
+        std::vector<std::string> configKeys = {IE::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                               ov::intel_auto::schedule_policy.name()};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric key: " << name;
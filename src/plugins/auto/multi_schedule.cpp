@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <numeric>
+
 #include "async_infer_request.hpp"
 #include "plugin.hpp"
 #include "multi_schedule.hpp"
@@ -139,6 +141,7 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
                               itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
     auto& workerRequests = _workerRequests[device];
     auto& idleWorkerRequests = _idleWorkerRequests[device];
+    auto& statistics = _multiSContext->_deviceStatistics[device];
     workerRequests.resize(numRequests);
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
@@ -148,11 +151,14 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
         auto* workerRequestPtr = &workerRequest;
         workerRequestPtr->_index = num++;
+        workerRequestPtr->_statistics = &statistics;
         IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
         workerRequest._inferRequest->SetCallback(
             [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                workerRequestPtr->_statistics->Completed(workerRequestPtr->_scheduledTime,
+                                                         workerRequestPtr->_scheduledInFlight);
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -178,6 +184,10 @@ bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Dev
         std::lock_guard<std::mutex> lock(_multiSContext->_mutex);
         return _multiSContext->_devicePriorities;
     }();
+    if (preferred_device.empty() &&
+        _multiSContext->_schedulePolicy == ov::intel_auto::SchedulePolicy::LATENCY_BALANCED) {
+        SortByExpectedCompletion(devices, _multiSContext->_deviceStatistics);
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
             continue;
@@ -196,6 +206,29 @@ bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Dev
     return false;
 }
 
+void MultiSchedule::SortByExpectedCompletion(std::vector<DeviceInformation>& devices,
+                                             const DeviceMap<DeviceStatistics>& statistics) {
+    // the devices without statistics (no workers) are tried last, ties keep the priority order
+    std::vector<double> expected(devices.size(), std::numeric_limits<double>::max());
+    for (size_t i = 0; i < devices.size(); i++) {
+        const auto it = statistics.find(devices[i].deviceName);
+        if (it != statistics.end()) {
+            expected[i] = it->second.ExpectedCompletionUs();
+        }
+    }
+    std::vector<size_t> order(devices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&expected](size_t a, size_t b) {
+        return expected[a] < expected[b];
+    });
+    std::vector<DeviceInformation> sorted;
+    sorted.reserve(devices.size());
+    for (auto i : order) {
+        sorted.push_back(std::move(devices[i]));
+    }
+    devices = std::move(sorted);
+}
+
 bool MultiSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     NotBusyWorkerRequests& idleWorkerRequests,
     const DeviceName& preferred_device) {
@@ -203,6 +236,8 @@ bool MultiSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     if (idleWorkerRequests.try_pop(workerRequestPtr)) {
         IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, idleWorkerRequests};
         _thisWorkerInferRequest = workerRequestPtr;
+        workerRequestPtr->_scheduledTime = std::chrono::steady_clock::now();
+        workerRequestPtr->_scheduledInFlight = workerRequestPtr->_statistics->Scheduled();
         {
             auto capturedTask = std::move(inferPipelineTask);
             capturedTask();
@@ -42,6 +42,9 @@ public:
     // the bug is e.g. manifesting on the old CentOS (and it's 4.8.x gcc) used in our testing
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81880
     static thread_local const char* _thisPreferredDeviceName;
+    // orders the devices by the expected completion time of a new request, used by the latency balanced policy
+    static void SortByExpectedCompletion(std::vector<DeviceInformation>& devices,
+                                         const DeviceMap<DeviceStatistics>& statistics);
 
 protected:
     virtual void GenerateWorkers(const std::string& device, const IE::SoExecutableNetworkInternal& executableNetwork);
@@ -69,6 +69,8 @@ namespace {
                     res.push_back(ov::hint::allow_auto_batching.name());
                     res.push_back(ov::log::level.name());
                     res.push_back(ov::intel_auto::device_bind_buffer.name());
+                    res.push_back(ov::intel_auto::schedule_policy.name());
+                    res.push_back(ov::intel_auto::cpu_help_release_delay.name());
                     res.push_back(ov::auto_batch_timeout.name());
                     return res;
                 }();
@@ -274,7 +276,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
                                                     RW_property(ov::hint::allow_auto_batching.name()),
                                                     RW_property(ov::auto_batch_timeout.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
-                                                    RW_property(ov::hint::num_requests.name())
+                                                    RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::intel_auto::schedule_policy.name()),
+                                                    RW_property(ov::intel_auto::cpu_help_release_delay.name())
         };
         std::vector<ov::PropertyName> supportedProperties;
         supportedProperties.reserve(roProperties.size() + rwProperties.size());
@@ -517,6 +521,22 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     multiSContext->_needPerfCounters = enablePerfCounters;
     multiSContext->_core = GetCore();
     multiSContext->_LogTag = _LogTag;
+    auto policyIter = fullConfig.find(ov::intel_auto::schedule_policy.name());
+    if (policyIter != fullConfig.end()) {
+        try {
+            std::stringstream strm{policyIter->second};
+            strm >> multiSContext->_schedulePolicy;
+        } catch (...) {
+            IE_THROW() << "Unsupported config value: " << policyIter->second
+                       << " for key: " << policyIter->first;
+        }
+    }
+    {
+        // the policy is reported by GetConfig of the compiled model, the default one too
+        std::stringstream strm;
+        strm << multiSContext->_schedulePolicy;
+        multiSContext->_config[ov::intel_auto::schedule_policy.name()] = strm.str();
+    }
     IExecutableNetworkInternal::Ptr impl;
     auto tmpiter = fullConfig.find(ov::intel_auto::device_bind_buffer.name());
     if (tmpiter != fullConfig.end() && tmpiter->second == PluginConfigParams::YES)
@@ -885,6 +905,27 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
                 IE_THROW() << "Unsupported config value: " << kvp.second
                            << " for key: " << kvp.first;
             }
+        } else if (kvp.first == ov::intel_auto::cpu_help_release_delay.name()) {
+            try {
+                auto delay = std::stoi(kvp.second);
+                if (delay < 0) {
+                    IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+                }
+                context->_cpuHelpReleaseDelay = static_cast<uint32_t>(delay);
+            } catch (...) {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
+        } else if (kvp.first == ov::intel_auto::schedule_policy.name()) {
+            try {
+                std::stringstream strm{kvp.second};
+                ov::intel_auto::SchedulePolicy policy;
+                strm >> policy;
+            } catch (...) {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
         } else if (std::find(perf_hints_configs.begin(), perf_hints_configs.end(), kvp.first) != perf_hints_configs.end()) {
             PerfHintsConfig::CheckConfigAndValue(kvp);
             if (kvp.first == PluginConfigParams::KEY_PERFORMANCE_HINT) {
@@ -18,8 +18,13 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
+            explicit RequestExecutor(HeteroInferRequest::SubRequestDesc& desc)
+                : _inferRequest(desc._request),
+                  _statistics(desc._statistics) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
+                    if (_statistics) {
+                        _statistics->end();
+                    }
                     _exceptionPtr = exceptionPtr;
                     auto capturedTask = std::move(_task);
                     capturedTask();
@@ -27,15 +32,25 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                if (_statistics) {
+                    _statistics->begin();
+                }
+                try {
+                    _inferRequest->StartAsync();
+                } catch (...) {
+                    if (_statistics) {
+                        _statistics->end();
+                    }
+                    throw;
+                }
             };
             SoIInferRequestInternal& _inferRequest;
+            StageStatistics::Ptr _statistics;
             std::exception_ptr _exceptionPtr;
             Task _task;
         };
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
+        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]);
         _pipeline.emplace_back(requestExecutor, [requestExecutor] {
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
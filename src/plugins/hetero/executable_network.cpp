@@ -35,6 +35,7 @@
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_algorithm.hpp"
+#include "ie_system_conf.h"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "plugin.hpp"
 #include <ie_algorithm.hpp>
@@ -58,6 +59,79 @@ using namespace InferenceEngine::HeteroConfigParams;
 template <typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+int getNumaPipelineStages(const std::map<std::string, std::string>& config) {
+    auto it = config.find(HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES));
+    if (it == config.end()) {
+        return 1;
+    }
+    int stages = 0;
+    try {
+        stages = std::stoi(it->second);
+    } catch (const std::exception&) {
+    }
+    if (stages < 1) {
+        IE_THROW() << "Wrong value " << it->second << " for config key " << HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES)
+                   << ". Expected only positive integer numbers";
+    }
+    return stages;
+}
+
+// Weights and activations a node streams through the memory, used to balance pipeline stages
+std::size_t getStageCost(const std::shared_ptr<ngraph::Node>& node) {
+    std::size_t cost = 0;
+    for (auto&& input : node->input_values()) {
+        if (ngraph::op::is_constant(input.get_node()) && input.get_partial_shape().is_static()) {
+            cost += ngraph::shape_size(input.get_shape()) * input.get_element_type().size();
+        }
+    }
+    for (auto&& output : node->outputs()) {
+        if (output.get_partial_shape().is_static()) {
+            cost += ngraph::shape_size(output.get_shape()) * output.get_element_type().size();
+        }
+    }
+    return std::max<std::size_t>(cost, 1);
+}
+
+// Splits topologically ordered nodes into consecutive stages of about the same cost.
+// Parameters and constants belong to the stage of their first consumer, results to the stage of their producer
+NodeMap<int> splitIntoStages(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps, int stagesNum) {
+    auto isComputation = [](const std::shared_ptr<ngraph::Node>& node) {
+        return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+    };
+    std::size_t totalCost = 0;
+    for (auto&& node : orderedOps) {
+        if (isComputation(node)) {
+            totalCost += getStageCost(node);
+        }
+    }
+
+    NodeMap<int> stages;
+    std::size_t cost = 0;
+    for (auto&& node : orderedOps) {
+        if (isComputation(node)) {
+            stages[node.get()] = static_cast<int>(std::min<std::size_t>(stagesNum - 1, cost * stagesNum / totalCost));
+            cost += getStageCost(node);
+        }
+    }
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node)) {
+            auto consumers = node->output(0).get_target_inputs();
+            auto itStage = consumers.empty() ? stages.end() : stages.find(consumers.begin()->get_node());
+            stages[node.get()] = itStage != stages.end() ? itStage->second : 0;
+        }
+    }
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_output(node)) {
+            stages[node.get()] = stages[node->input_value(0).get_node()];
+        }
+    }
+    return stages;
+}
+
+}  // namespace
+
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwork& network,
                                                  const Engine::Configs& config,
                                                  Engine* plugin)
@@ -153,6 +227,17 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         }
     }
 
+    // Split a network placed on CPU into pipeline stages bound to different NUMA nodes
+    const int numaPipelineStages = getNumaPipelineStages(_config);
+    NodeMap<int> stages;
+    if (numaPipelineStages > 1) {
+        if (devices.size() != 1 || DeviceIDParser(*devices.begin()).getDeviceName() != "CPU") {
+            IE_THROW() << HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES)
+                       << " can be used only if the whole network is placed on CPU";
+        }
+        stages = splitIntoStages(orderedOps, numaPipelineStages);
+    }
+
     static const std::array<const char*, 14> colors = {
         "aliceblue",
         "antiquewhite4",
@@ -213,7 +298,8 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 nodeInputDependency.insert(input);
                 auto& inputDependency = nodeInputDependencies[InputNode(input)];
                 nodeInputDependency.insert(inputDependency.begin(), inputDependency.end());
-                if (affinities[node.get()] != affinities[InputNode(input)]) {
+                if (affinities[node.get()] != affinities[InputNode(input)] ||
+                    stages[node.get()] != stages[InputNode(input)]) {
                     subgraphInputs.insert(input);
                 }
             }
@@ -385,6 +471,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         ngraph::ParameterVector _parameters;
         ngraph::SinkVector _sinks;
         std::string _affinity;
+        int _stage;
     };
     std::unordered_map<int, Subgraph> subgraphs;
     // Extracts subgraph parameters, results and affinities
@@ -403,6 +490,10 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         if (itAffinity != affinities.end()) {
             subgraph._affinity = itAffinity->second;
         }
+        auto itStage = stages.find(node);
+        if (itStage != stages.end()) {
+            subgraph._stage = itStage->second;
+        }
     }
     results = {};
 
@@ -448,9 +539,12 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     OutputsDataMap externalOutputsData = network.getOutputsInfo();
     _networks.resize(orderedSubgraphs.size());
     std::vector<std::shared_ptr<ngraph::Function>> subFunctions(orderedSubgraphs.size());
+    const int numaNodesNum = static_cast<int>(getAvailableNUMANodes().size());
     int id = 0;
     for (auto&& subgraph : orderedSubgraphs) {
         _networks[id]._device = subgraph._affinity;
+        _networks[id]._numaNode = numaPipelineStages > 1 ? subgraph._stage % numaNodesNum : -1;
+        _networks[id]._statistics = std::make_shared<StageStatistics>();
         subFunctions[id] = std::make_shared<ngraph::Function>(subgraph._results,
                                                               subgraph._sinks,
                                                               subgraph._parameters,
@@ -512,6 +606,12 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     for (auto&& network : _networks) {
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
         metaDevices[network._device].emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+        if (network._numaNode >= 0) {
+            // stages are executed by their own executors, otherwise requests don't flow through them concurrently
+            metaDevices[network._device][CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] = CONFIG_VALUE(NO);
+            metaDevices[network._device][CONFIG_KEY(CPU_BIND_THREAD)] = CONFIG_VALUE(NUMA);
+            metaDevices[network._device][CONFIG_KEY_INTERNAL(CPU_BIND_NUMA_NODE)] = std::to_string(network._numaNode);
+        }
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
                                                                  network._device,
                                                                  metaDevices[network._device]);
@@ -565,9 +665,16 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     FOREACH_CHILD (subnetworkNode, subnetworksNode, "subnetwork") {
         auto deviceName = GetStrAttr(subnetworkNode, "device");
 
+        auto numaNode = GetIntAttr(subnetworkNode, "numa_node", -1);
+
         auto metaDevices = _heteroPlugin->GetDevicePlugins(deviceName, importedConfigs);
         assert(metaDevices.size() == 1);
         auto& loadConfig = metaDevices[deviceName];
+        if (numaNode >= 0) {
+            loadConfig[CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] = CONFIG_VALUE(NO);
+            loadConfig[CONFIG_KEY(CPU_BIND_THREAD)] = CONFIG_VALUE(NUMA);
+            loadConfig[CONFIG_KEY_INTERNAL(CPU_BIND_NUMA_NODE)] = std::to_string(numaNode);
+        }
 
         InferenceEngine::SoExecutableNetworkInternal executableNetwork;
         CNNNetwork cnnnetwork;
@@ -630,6 +737,8 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
             deviceName,
             loaded ? cnnnetwork : CNNNetwork{},
             executableNetwork,
+            numaNode,
+            std::make_shared<StageStatistics>(),
         });
     }
 
@@ -735,6 +844,7 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
 
         auto subnetworkNode = subnetworksNode.append_child("subnetwork");
         subnetworkNode.append_attribute("device").set_value(subnetwork._device.c_str());
+        subnetworkNode.append_attribute("numa_node").set_value(subnetwork._numaNode);
 
         // inputs info
         auto subnetworkInputsNode = subnetworkNode.append_child("inputs");
@@ -815,6 +925,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._statistics = subnetwork._statistics;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
@@ -828,6 +939,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._statistics = subnetwork._statistics;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
@@ -853,6 +965,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES)) {
+        result = std::to_string(getNumaPipelineStages(_config));
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -911,7 +1025,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroMetrics = {ov::model_name.name(),
                                                   METRIC_KEY(SUPPORTED_METRICS),
                                                   METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                                                  ov::optimal_number_of_infer_requests.name()};
+                                                  ov::optimal_number_of_infer_requests.name(),
+                                                  HETERO_METRIC_KEY(STAGES_STATISTICS)};
 
         {
             std::vector<::Metrics> pluginMetrics;
@@ -933,6 +1048,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -954,12 +1070,28 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (ov::model_name == name) {
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // NUMA pipeline stages are loaded by their own requests, so that a request enters a stage while
+        // the previous one is executed by the next stage, otherwise the slowest subnetwork bounds the value
+        const bool pipelined = getNumaPipelineStages(_config) > 1;
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            const auto optimalNum =
+                desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            value = pipelined ? value + optimalNum : std::max(value, optimalNum);
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
+    } else if (HETERO_METRIC_KEY(STAGES_STATISTICS) == name) {
+        std::map<std::string, uint64_t> statistics;
+        for (std::size_t i = 0; i < _networks.size(); i++) {
+            const auto snapshot = _networks[i]._statistics->snapshot();
+            const auto prefix = "stage" + std::to_string(i) + ".";
+            statistics[prefix + "inferences"] = snapshot.inferences;
+            statistics[prefix + "busy_us"] = snapshot.busyTime;
+            statistics[prefix + "utilization_percent"] =
+                snapshot.elapsedTime > 0 ? std::min<uint64_t>(100, snapshot.busyTime * 100 / snapshot.elapsedTime)
+                                         : 0;
+        }
+        IE_SET_METRIC_RETURN(HETERO_STAGES_STATISTICS, statistics);
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : _networks) {
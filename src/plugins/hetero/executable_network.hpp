@@ -70,6 +70,8 @@ private:
         std::string _device;
         InferenceEngine::CNNNetwork _clonedNetwork;
         InferenceEngine::SoExecutableNetworkInternal _network;
+        int _numaNode;  // NUMA node the CPU pipeline stage is bound to, -1 if the network is not a pipeline stage
+        StageStatistics::Ptr _statistics;
     };
 
     std::vector<NetworkDesc> _networks;
@@ -123,7 +123,20 @@ void HeteroInferRequest::InferImpl() {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
         assert(r);
-        r->Infer();
+        if (desc._statistics) {
+            desc._statistics->begin();
+        }
+        try {
+            r->Infer();
+        } catch (...) {
+            if (desc._statistics) {
+                desc._statistics->end();
+            }
+            throw;
+        }
+        if (desc._statistics) {
+            desc._statistics->end();
+        }
     }
 }
 
@@ -8,8 +8,10 @@
 
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <openvino/itt.hpp>
 #include <string>
 #include <unordered_map>
@@ -17,6 +19,66 @@
 
 namespace HeteroPlugin {
 
+/**
+ * @brief Execution statistics of a subnetwork shared by subrequests of all infer requests.
+ * Subrequests of different infer requests may execute the stage concurrently, so the busy time is the wall-clock
+ * time during which at least one of them is running rather than the sum of their execution times.
+ */
+struct StageStatistics {
+    using Clock = std::chrono::steady_clock;
+    using Ptr = std::shared_ptr<StageStatistics>;
+
+    struct Snapshot {
+        uint64_t inferences = 0;
+        uint64_t busyTime = 0;     // microseconds
+        uint64_t elapsedTime = 0;  // microseconds since the first inference
+    };
+
+    void begin() {
+        const auto now = Clock::now();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_running++ == 0) {
+            _busyStart = now;
+        }
+        if (!_started) {
+            _firstStart = now;
+            _started = true;
+        }
+    }
+
+    void end() {
+        const auto now = Clock::now();
+        std::lock_guard<std::mutex> lock(_mutex);
+        _inferences++;
+        if (--_running == 0) {
+            _busyTime += now - _busyStart;
+        }
+    }
+
+    Snapshot snapshot() const {
+        const auto now = Clock::now();
+        std::lock_guard<std::mutex> lock(_mutex);
+        Snapshot snapshot;
+        if (!_started) {
+            return snapshot;
+        }
+        const auto busyTime = _running > 0 ? _busyTime + (now - _busyStart) : _busyTime;
+        snapshot.inferences = _inferences;
+        snapshot.busyTime = std::chrono::duration_cast<std::chrono::microseconds>(busyTime).count();
+        snapshot.elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(now - _firstStart).count();
+        return snapshot;
+    }
+
+private:
+    mutable std::mutex _mutex;
+    uint64_t _inferences = 0;
+    std::size_t _running = 0;
+    bool _started = false;
+    Clock::duration _busyTime{0};
+    Clock::time_point _busyStart;
+    Clock::time_point _firstStart;
+};
+
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -25,6 +87,7 @@ public:
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        StageStatistics::Ptr _statistics;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
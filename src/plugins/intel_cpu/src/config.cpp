@@ -16,13 +16,53 @@
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include <cpu/x64/cpu_isa_traits.hpp>
 
+#include <sstream>
+
 namespace ov {
 namespace intel_cpu {
 
 using namespace InferenceEngine;
 
+namespace {
+// parses "[1,128],[1,128];[1,256],[1,256]" into the list of buckets with shapes of all the inputs
+std::vector<std::vector<SizeVector>> parseShapeBuckets(const std::string& value) {
+    std::vector<std::vector<SizeVector>> buckets;
+    std::stringstream bucketsStream(value);
+    std::string bucketStr;
+    while (std::getline(bucketsStream, bucketStr, ';')) {
+        std::vector<SizeVector> bucket;
+        size_t pos = 0;
+        while ((pos = bucketStr.find('[', pos)) != std::string::npos) {
+            const auto end = bucketStr.find(']', pos);
+            if (end == std::string::npos)
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shape_buckets.name()
+                           << ". Unclosed bracket in shape: " << bucketStr;
+            SizeVector dims;
+            std::stringstream dimsStream(bucketStr.substr(pos + 1, end - pos - 1));
+            std::string dim;
+            while (std::getline(dimsStream, dim, ',')) {
+                try {
+                    dims.push_back(std::stoul(dim));
+                } catch (const std::exception&) {
+                    IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shape_buckets.name()
+                               << ". Expected only static dimensions, got: " << dim;
+                }
+            }
+            bucket.push_back(dims);
+            pos = end + 1;
+        }
+        if (bucket.empty())
+            IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shape_buckets.name()
+                       << ". Empty bucket in: " << value;
+        buckets.push_back(bucket);
+    }
+    return buckets;
+}
+}  // namespace
+
 Config::Config() {
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
@@ -137,6 +177,85 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             }
         } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
             cache_dir = val;
+        } else if (key == ov::intel_cpu::perf_sampling_rate.name()) {
+            try {
+                perfSamplingRate = static_cast<uint32_t>(std::stoul(val));
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::perf_sampling_rate.name()
+                           << ". Expected only non negative integer numbers";
+            }
+        } else if (key == ov::intel_cpu::profile_transformations.name()) {
+            if (val == PluginConfigParams::YES) {
+                profileTransformations = true;
+            } else if (val == PluginConfigParams::NO) {
+                profileTransformations = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::profile_transformations.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::memory_allocator.name()) {
+            if (val == "DEFAULT") {
+                memoryAllocator = MemoryAllocator::DEFAULT;
+            } else if (val == "TRANSPARENT_HUGE_PAGES") {
+                memoryAllocator = MemoryAllocator::TRANSPARENT_HUGE_PAGES;
+            } else if (val == "HUGE_PAGES") {
+                memoryAllocator = MemoryAllocator::HUGE_PAGES;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::memory_allocator.name()
+                           << ". Expected only DEFAULT/TRANSPARENT_HUGE_PAGES/HUGE_PAGES";
+            }
+        } else if (key == ov::intel_cpu::primitives_autotuning.name()) {
+            if (val == PluginConfigParams::YES) {
+                primitivesAutotuning = true;
+            } else if (val == PluginConfigParams::NO) {
+                primitivesAutotuning = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::primitives_autotuning.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::depth_first_tiling.name()) {
+            if (val == PluginConfigParams::YES) {
+                depthFirstTiling = true;
+            } else if (val == PluginConfigParams::NO) {
+                depthFirstTiling = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::depth_first_tiling.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::intra_request_streams.name()) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::intra_request_streams.name()
+                           << ". Expected only positive integer numbers";
+            }
+            if (val_i < 1) {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::intra_request_streams.name()
+                           << ". Expected only positive integer numbers";
+            }
+            intraRequestStreams = static_cast<uint32_t>(val_i);
+        } else if (key == ov::intel_cpu::layout_assignment.name()) {
+            if (val == PluginConfigParams::YES) {
+                layoutAssignment = true;
+            } else if (val == PluginConfigParams::NO) {
+                layoutAssignment = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::layout_assignment.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::mha_fusion.name()) {
+            if (val == PluginConfigParams::YES) {
+                mhaFusion = true;
+            } else if (val == PluginConfigParams::NO) {
+                mhaFusion = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::mha_fusion.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::shape_buckets.name()) {
+            shapeBuckets = parseShapeBuckets(val);
+            shapeBucketsStr = val;
         } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY == key) {
             int val_i = -1;
             try {
@@ -222,6 +341,21 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+    _config.insert({ov::intel_cpu::shape_buckets.name(), shapeBucketsStr});
+    _config.insert({ov::intel_cpu::perf_sampling_rate.name(), std::to_string(perfSamplingRate)});
+    _config.insert({ov::intel_cpu::profile_transformations.name(),
+                    profileTransformations ? PluginConfigParams::YES : PluginConfigParams::NO});
+    std::stringstream allocator;
+    allocator << memoryAllocator;
+    _config.insert({ov::intel_cpu::memory_allocator.name(), allocator.str()});
+    _config.insert({ov::intel_cpu::primitives_autotuning.name(),
+                    primitivesAutotuning ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::depth_first_tiling.name(),
+                    depthFirstTiling ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::intra_request_streams.name(), std::to_string(intraRequestStreams)});
+    _config.insert({ov::intel_cpu::layout_assignment.name(),
+                    layoutAssignment ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::mha_fusion.name(), mhaFusion ? PluginConfigParams::YES : PluginConfigParams::NO});
 }
 
 #ifdef CPU_DEBUG_CAPS
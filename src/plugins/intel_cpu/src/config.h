@@ -6,10 +6,13 @@
 
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
+#include <ie_common.h>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 #include "utils/debug_capabilities.h"
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -48,6 +51,34 @@ struct Config {
 
     std::string cache_dir{};
 
+    // static input shapes (in model parameters order) of every shape bucket
+    std::vector<std::vector<InferenceEngine::SizeVector>> shapeBuckets;
+    std::string shapeBucketsStr{};
+
+    // every N-th inference is sampled into the per node ring buffer, 0 disables sampling
+    uint32_t perfSamplingRate = 0;
+
+    // statistics of transformations are collected during compilation
+    bool profileTransformations = false;
+
+    // allocator of memory managers and infer request blobs
+    MemoryAllocator memoryAllocator = MemoryAllocator::DEFAULT;
+
+    // primitive descriptors are selected by measured execution time
+    bool primitivesAutotuning = false;
+
+    // chains of spatially local operations are executed band by band
+    bool depthFirstTiling = false;
+
+    // independent nodes of an inference are executed concurrently by the given number of core groups, 1 disables it
+    uint32_t intraRequestStreams = 1;
+
+    // selected primitive descriptors are refined graph wide to avoid reorders
+    bool layoutAssignment = false;
+
+    // attention subgraphs are fused into MHA nodes
+    bool mhaFusion = false;
+
     DenormalsOptMode denormalsOptMode = DenormalsOptMode::DO_Keep;
 
     void readProperties(const std::map<std::string, std::string> &config);
@@ -0,0 +1,147 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_allocator.h"
+
+#include <common/utils.hpp>
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr size_t cacheLineSize = 64;
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+thread_local MemoryAllocator currentAllocator = MemoryAllocator::DEFAULT;
+
+size_t roundUpToHugePage(size_t size) {
+    return (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+}
+
+// small buffers do not benefit from huge pages, they are allocated by the default allocator
+bool useHugePages(MemoryAllocator allocator, size_t size) {
+#if defined(__linux__)
+    return allocator != MemoryAllocator::DEFAULT && size >= hugePageSize;
+#else
+    return false;
+#endif
+}
+
+class BlobAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit BlobAllocator(MemoryAllocator allocator) : allocator(allocator) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        try {
+            auto ptr = CpuAllocator::allocate(allocator, size);
+            std::lock_guard<std::mutex> lock{mutex};
+            sizes[ptr] = size;
+            return ptr;
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    bool free(void* handle) noexcept override {
+        size_t size = 0;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            auto it = sizes.find(handle);
+            if (it == sizes.end())
+                return false;
+            size = it->second;
+            sizes.erase(it);
+        }
+        CpuAllocator::free(allocator, handle, size);
+        return true;
+    }
+
+private:
+    const MemoryAllocator allocator;
+    std::mutex mutex;
+    std::unordered_map<void*, size_t> sizes;
+};
+
+}   // namespace
+
+CpuAllocator::Scope::Scope(MemoryAllocator allocator) : previous(currentAllocator) {
+    currentAllocator = allocator;
+}
+
+CpuAllocator::Scope::~Scope() {
+    currentAllocator = previous;
+}
+
+MemoryAllocator CpuAllocator::current() {
+    return currentAllocator;
+}
+
+void* CpuAllocator::allocate(MemoryAllocator allocator, size_t size) {
+    void* ptr = nullptr;
+    if (!useHugePages(allocator, size)) {
+        ptr = dnnl::impl::malloc(size, cacheLineSize);
+        if (!ptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+#if defined(__linux__)
+    const auto mappedSize = roundUpToHugePage(size);
+    if (allocator == MemoryAllocator::HUGE_PAGES) {
+        ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+            return ptr;
+        // the pool of reserved huge pages is exhausted or not configured, fall back to transparent huge pages
+        ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            throw std::bad_alloc();
+    } else {
+        if (posix_memalign(&ptr, hugePageSize, mappedSize) != 0)
+            throw std::bad_alloc();
+    }
+    // the advice is ignored if transparent huge pages are disabled in the system
+    madvise(ptr, mappedSize, MADV_HUGEPAGE);
+#endif
+    return ptr;
+}
+
+void CpuAllocator::free(MemoryAllocator allocator, void* ptr, size_t size) noexcept {
+    if (!ptr)
+        return;
+    if (!useHugePages(allocator, size)) {
+        dnnl::impl::free(ptr);
+        return;
+    }
+#if defined(__linux__)
+    if (allocator == MemoryAllocator::HUGE_PAGES) {
+        munmap(ptr, roundUpToHugePage(size));
+    } else {
+        std::free(ptr);
+    }
+#endif
+}
+
+std::shared_ptr<InferenceEngine::IAllocator> createBlobAllocator(MemoryAllocator allocator) {
+    if (allocator == MemoryAllocator::DEFAULT)
+        return nullptr;
+    return std::make_shared<BlobAllocator>(allocator);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,55 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Allocation routines for the buffers of memory managers and infer request blobs
+ */
+class CpuAllocator {
+public:
+    /**
+     * @brief Sets the allocator of memory managers created on the current thread until the scope is destroyed
+     */
+    class Scope {
+    public:
+        explicit Scope(MemoryAllocator allocator);
+        ~Scope();
+
+    private:
+        MemoryAllocator previous;
+    };
+
+    /**
+     * @brief The allocator of memory managers created on the current thread
+     */
+    static MemoryAllocator current();
+
+    /**
+     * @brief Allocates at least size bytes aligned to the cache line, throws std::bad_alloc on failure
+     */
+    static void* allocate(MemoryAllocator allocator, size_t size);
+
+    /**
+     * @brief Releases memory allocated by allocate() with the same allocator and size
+     */
+    static void free(MemoryAllocator allocator, void* ptr, size_t size) noexcept;
+};
+
+/**
+ * @brief Creates the allocator of infer request blobs, nullptr for the default allocator
+ */
+std::shared_ptr<InferenceEngine::IAllocator> createBlobAllocator(MemoryAllocator allocator);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -180,16 +180,15 @@ void MemoryMngrWithReuse::setExtBuff(void *ptr, size_t size) {
 }
 
 bool MemoryMngrWithReuse::resize(size_t size) {
-    constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
-        if (!ptr) {
-            throw std::bad_alloc();
-        }
+        void *ptr = CpuAllocator::allocate(_allocator, size);
         _memUpperBound = size;
         _useExternalStorage = false;
-        _data = decltype(_data)(ptr, destroy);
+        const auto allocator = _allocator;
+        _data = decltype(_data)(ptr, [allocator, size](void *ptr) {
+            CpuAllocator::free(allocator, ptr, size);
+        });
         sizeChanged = true;
     }
     return sizeChanged;
@@ -201,10 +200,6 @@ bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
 
 void MemoryMngrWithReuse::release(void *ptr) {}
 
-void MemoryMngrWithReuse::destroy(void *ptr) {
-    dnnl::impl::free(ptr);
-}
-
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return _pMemMngr->getRawPtr();
 }
@@ -245,5 +240,30 @@ void DnnlMemoryMngr::notifyUpdate() {
         }
     }
 }
+
+void* PartitionedMemoryMngr::getRawPtr() const noexcept {
+    return static_cast<uint8_t*>(_pBaseMngr->getRawPtr()) + _size / _sizeBlocks * _offsetBlocks;
+}
+
+void PartitionedMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    IE_THROW(Unexpected) << "External buffer cannot be set to a part of the memory";
+}
+
+bool PartitionedMemoryMngr::resize(size_t size) {
+    _size = size;
+    return _pBaseMngr->resize(size / _sizeBlocks * _totalBlocks);
+}
+
+bool PartitionedMemoryMngr::hasExtBuffer() const noexcept {
+    return _pBaseMngr->hasExtBuffer();
+}
+
+void PartitionedMemoryMngr::registerMemory(Memory* memPtr) {
+    _pBaseMngr->registerMemory(memPtr);
+}
+
+void PartitionedMemoryMngr::unregisterMemory(Memory* memPtr) {
+    _pBaseMngr->unregisterMemory(memPtr);
+}
 }   // namespace intel_cpu
 }   // namespace ov
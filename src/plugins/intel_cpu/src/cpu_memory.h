@@ -5,6 +5,7 @@
 #pragma once
 
 #include "ie_layouts.h"
+#include "cpu_allocator.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "dnnl_extension_utils.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -74,7 +75,7 @@ public:
  */
 class MemoryMngrWithReuse : public IMemoryMngr {
 public:
-    MemoryMngrWithReuse() : _data(nullptr, release) {}
+    MemoryMngrWithReuse() : _allocator(CpuAllocator::current()), _data(nullptr, release) {}
     void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
@@ -83,10 +84,10 @@ public:
 private:
     bool _useExternalStorage = false;
     size_t _memUpperBound = 0ul;
-    std::unique_ptr<void, void (*)(void *)> _data;
+    MemoryAllocator _allocator;
+    std::unique_ptr<void, std::function<void(void *)>> _data;
 
     static void release(void *ptr);
-    static void destroy(void *ptr);
 };
 
 /**
@@ -99,8 +100,8 @@ public:
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
-    void registerMemory(Memory* memPtr);
-    void unregisterMemory(Memory* memPtr);
+    virtual void registerMemory(Memory* memPtr);
+    virtual void unregisterMemory(Memory* memPtr);
 
 private:
     void notifyUpdate();
@@ -113,6 +114,32 @@ private:
 using DnnlMemoryMngrPtr = std::shared_ptr<DnnlMemoryMngr>;
 using DnnlMemoryMngrCPtr = std::shared_ptr<const DnnlMemoryMngr>;
 
+/**
+ * @brief A view on a contiguous part of the memory of another manager, used to share memory between in-place
+ * nodes with dynamic shapes. The memory is split into totalBlocks blocks of the same size, the part starts at
+ * offsetBlocks and contains sizeBlocks of them, so the size of the block is derived from the size requested for
+ * the part on every resize. The memory objects are registered in the base manager to be notified on reallocation.
+ */
+class PartitionedMemoryMngr : public DnnlMemoryMngr {
+public:
+    PartitionedMemoryMngr(DnnlMemoryMngrPtr pBaseMngr, size_t totalBlocks, size_t offsetBlocks, size_t sizeBlocks)
+        : DnnlMemoryMngr(nullptr), _pBaseMngr(pBaseMngr), _totalBlocks(totalBlocks), _offsetBlocks(offsetBlocks),
+          _sizeBlocks(sizeBlocks) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+    void registerMemory(Memory* memPtr) override;
+    void unregisterMemory(Memory* memPtr) override;
+
+private:
+    DnnlMemoryMngrPtr _pBaseMngr;
+    size_t _totalBlocks = 1;
+    size_t _offsetBlocks = 0;
+    size_t _sizeBlocks = 1;
+    size_t _size = 0;
+};
+
 class DnnlMemMngrHandle {
 public:
     DnnlMemMngrHandle(DnnlMemoryMngrPtr pMgr, Memory* pMem) : _pMgr(pMgr), _pMem(pMem) {
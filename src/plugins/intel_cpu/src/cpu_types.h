@@ -107,6 +107,7 @@ enum class Type {
     Subgraph,
     PriorBox,
     PriorBoxClustered,
+    MHA,
 };
 
 enum class Algorithm {
@@ -21,14 +21,18 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include "openvino/core/compilation_monitor.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -56,6 +60,22 @@ ExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs
     return std::make_shared<LegacyInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<ExecNetwork>(shared_from_this()));
 }
 
+namespace {
+
+// clones the model with the inputs reshaped, the graphs of all streams are replicated from the same clone
+std::shared_ptr<const ov::Model> cloneReshaped(const std::shared_ptr<const ov::Model>& model,
+        const std::function<ov::PartialShape(const ov::op::v0::Parameter&)>& getShape) {
+    auto reshaped = ngraph::clone_function(*model);
+    std::map<ov::Output<ov::Node>, ov::PartialShape> newInShape;
+    for (const auto& in : reshaped->get_parameters()) {
+        newInShape[in] = getShape(*in);
+    }
+    reshaped->reshape(newInShape);
+    return reshaped;
+}
+
+}   // namespace
+
 struct ImmediateSerialExecutor : public ITaskExecutor {
     void run(InferenceEngine::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -67,17 +87,23 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const std::string& transformationsProfile) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _network(network) {
+    _network(network),
+    _transformationsProfile(transformationsProfile),
+    _blobAllocator(createBlobAllocator(cfg.memoryAllocator)) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
     }
+    if (_cfg.primitivesAutotuning) {
+        _primitiveTuner = std::make_shared<PrimitiveTuner>(_cfg.cache_dir, function);
+    }
     bool isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
     _cfg.isNewApi = !isLegacyAPI();
@@ -95,13 +121,25 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
             IE_THROW() << "Graph::CreateGraph: such topology cannot be compiled for dynamic batch!";
         }
     }
+    if (_cfg.isNewApi && _cfg.batchLimit > 0) {
+        const auto batchLimit = _cfg.batchLimit;
+        _upperBoundModel = cloneReshaped(function, [batchLimit](const ov::op::v0::Parameter& in) {
+            auto newShape = in.get_output_partial_shape(0);
+            newShape[0] = batchLimit;
+            return newShape;
+        });
+    }
 
+    // threads an inference is executed on
+    int streamThreads = parallel_get_max_threads();
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+        if (streamsExecutorConfig._threadsPerStream > 0)
+            streamThreads = streamsExecutorConfig._threadsPerStream;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
@@ -120,25 +158,71 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    if (!_cfg.shapeBuckets.empty()) {
+        CreateShapeBuckets(function);
+    }
+
+    const auto monitor = ov::CompilationMonitor::get_current();
+    if (monitor) {
+        monitor->report(ov::CompilationStage::GRAPH_BUILD);
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    if (_cfg.intraRequestStreams > 1) {
+        if (streams > 1) {
+            // the streams already load all the cores, the groups of their inferences would oversubscribe them
+            _cfg.intraRequestStreams = 1;
+            auto option = _cfg._config.find(ov::intel_cpu::intra_request_streams.name());
+            if (option != _cfg._config.end())
+                option->second = "1";
+        } else {
+            // the only stream waits for the groups to finish a wave, so the groups take its threads and pinning
+            const int groups = static_cast<int>(_cfg.intraRequestStreams);
+            _intraRequestExecutor = std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+                InferenceEngine::IStreamsExecutor::Config{"CPUIntraRequestStreams", groups,
+                                                          std::max(1, streamThreads / groups),
+                                                          _cfg.streamExecutorConfig._threadBindingType});
+        }
+    }
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    for (auto& bucket : _shapeBuckets) {
+        bucket->graphs.resize(streams);
+    }
     if (_cfg.streamExecutorConfig._streams != 0) {
         auto all_graphs_ready = [&] {
-            return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
+            auto ready = [&] (Graph& graph) {
                 return graph.IsReady();
-            });
+            };
+            return std::all_of(_graphs.begin(), _graphs.end(), ready) &&
+                   std::all_of(_shapeBuckets.begin(), _shapeBuckets.end(), [&] (const std::unique_ptr<ShapeBucket>& bucket) {
+                       return std::all_of(bucket->graphs.begin(), bucket->graphs.end(), ready);
+                   });
+        };
+        // graphs are created on threads of the streams executor, so the compilation monitor
+        // of the calling thread is passed to them explicitly
+        auto create_graphs = [this, monitor] {
+            ov::CompilationMonitor::Scope monitorScope{monitor};
+            ExecNetwork::GetGraph();
+            for (const auto& bucket : _shapeBuckets) {
+                ExecNetwork::GetGraph(bucket.get());
+            }
         };
         do {
             for (auto&& task : tasks) {
-                task = [this] {
-                    ExecNetwork::GetGraph();
-                };
+                task = create_graphs;
             }
             _taskExecutor->runAndWait(tasks);
         } while (!all_graphs_ready());
     } else {
         ExecNetwork::GetGraph();
+        for (const auto& bucket : _shapeBuckets) {
+            ExecNetwork::GetGraph(bucket.get());
+        }
+    }
+
+    if (_primitiveTuner) {
+        _primitiveTuner->save();
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -165,7 +249,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
-ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
+ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph(const ShapeBucket* bucket) const {
     int streamId = 0;
     int numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
@@ -173,7 +257,9 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    auto& graphs = bucket ? bucket->graphs : _graphs;
+    auto& numaNodesWeights = bucket ? bucket->numaNodesWeights : _numaNodesWeights;
+    auto graphLock = GraphGuard::Lock(graphs[streamId % graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -182,7 +268,12 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.setSpecializedModel(bucket ? bucket->model : _upperBoundModel);
+                graphLock._graph.setPerfSamples(_perfSamples);
+                graphLock._graph.setPrimitiveTuner(_primitiveTuner);
+                graphLock._graph.setIntraRequestExecutor(_intraRequestExecutor);
+                CpuAllocator::Scope allocatorScope(graphLock._graph.getConfig().memoryAllocator);
+                graphLock._graph.CreateGraph(_network, extensionManager, numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -199,19 +290,87 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+void ExecNetwork::CreateShapeBuckets(const std::shared_ptr<const ov::Model>& function) {
+    const auto& params = function->get_parameters();
+    if (!_cfg.isNewApi || _cfg.batchLimit > 0)
+        IE_THROW() << ov::intel_cpu::shape_buckets.name() << " is supported only with OpenVINO 2.0 API without dynamic batch";
+    if (!function->get_sinks().empty())
+        IE_THROW() << ov::intel_cpu::shape_buckets.name() << " is not supported for models with states";
+    if (std::none_of(params.begin(), params.end(), [](const std::shared_ptr<ov::op::v0::Parameter>& param) {
+            return param->get_output_partial_shape(0).is_dynamic();
+        }))
+        IE_THROW() << ov::intel_cpu::shape_buckets.name() << " is applicable only to models with dynamic inputs";
+
+    for (const auto& bucketShapes : _cfg.shapeBuckets) {
+        if (bucketShapes.size() != params.size())
+            IE_THROW() << ov::intel_cpu::shape_buckets.name() << ": bucket has " << bucketShapes.size()
+                       << " shapes while model has " << params.size() << " inputs";
+
+        std::unique_ptr<ShapeBucket> bucket(new ShapeBucket);
+        for (size_t i = 0; i < params.size(); i++) {
+            const auto& pshape = params[i]->get_output_partial_shape(0);
+            if (!pshape.compatible(ov::PartialShape(ov::Shape(bucketShapes[i]))))
+                IE_THROW() << ov::intel_cpu::shape_buckets.name() << ": shape " << ov::Shape(bucketShapes[i])
+                           << " is not compatible with input " << params[i]->get_friendly_name() << " " << pshape;
+            bucket->inputShapes[params[i]->get_friendly_name()] = bucketShapes[i];
+            bucket->name += std::string(i ? ",[" : "[") + ov::util::join(bucketShapes[i], ",") + "]";
+        }
+        bucket->model = cloneReshaped(function, [&bucket](const ov::op::v0::Parameter& in) {
+            const auto shape = bucket->inputShapes.find(in.get_friendly_name());
+            return shape != bucket->inputShapes.end() ? ov::PartialShape(ov::Shape(shape->second))
+                                                      : in.get_output_partial_shape(0);
+        });
+        _shapeBuckets.push_back(std::move(bucket));
+    }
+}
+
+const ExecNetwork::ShapeBucket* ExecNetwork::FindShapeBucket(const InferenceEngine::BlobMap& inputs) const {
+    if (_shapeBuckets.empty())
+        return nullptr;
+
+    for (const auto& bucket : _shapeBuckets) {
+        const bool match = std::all_of(bucket->inputShapes.begin(), bucket->inputShapes.end(),
+            [&inputs](const std::pair<const std::string, InferenceEngine::SizeVector>& input) {
+                const auto blob = inputs.find(input.first);
+                return blob != inputs.end() && blob->second->getTensorDesc().getDims() == input.second;
+            });
+        if (match) {
+            bucket->hits++;
+            return bucket.get();
+        }
+    }
+    _shapeBucketsMisses++;
+    return nullptr;
+}
+
 void ExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
         _cfg.readProperties(properties);
     }
-    for (auto& g : _graphs) {
-        auto graphLock = GraphGuard::Lock(g);
-        if (graphLock._graph.IsReady()) {
-            graphLock._graph.setProperty(properties);
+    auto setGraphsProperty = [&properties](std::deque<GraphGuard>& graphs) {
+        for (auto& g : graphs) {
+            auto graphLock = GraphGuard::Lock(g);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.setProperty(properties);
+            }
         }
+    };
+    setGraphsProperty(_graphs);
+    for (auto& bucket : _shapeBuckets) {
+        setGraphsProperty(bucket->graphs);
     }
 }
 
+void ExecNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    auto rate = config.find(ov::intel_cpu::perf_sampling_rate.name());
+    if (rate == config.end() || config.size() > 1) {
+        IE_THROW() << "The only config that can be changed on the fly for the CPU compiled model is the "
+                   << ov::intel_cpu::perf_sampling_rate.name();
+    }
+    setProperty({{rate->first, rate->second.as<std::string>()}});
+}
+
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
 }
@@ -300,6 +459,9 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
+    auto RW_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RW);
+    };
 
     if (name == ov::supported_properties) {
         return std::vector<ov::PropertyName> {
@@ -313,6 +475,19 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::shape_buckets.name()),
+            RO_property(ov::intel_cpu::shape_buckets_statistics.name()),
+            RW_property(ov::intel_cpu::perf_sampling_rate.name()),
+            RO_property(ov::intel_cpu::perf_samples.name()),
+            RO_property(ov::intel_cpu::profile_transformations.name()),
+            RO_property(ov::intel_cpu::transformations_profile.name()),
+            RO_property(ov::intel_cpu::memory_allocator.name()),
+            RO_property(ov::intel_cpu::primitives_autotuning.name()),
+            RO_property(ov::intel_cpu::depth_first_tiling.name()),
+            RO_property(ov::intel_cpu::intra_request_streams.name()),
+            RO_property(ov::intel_cpu::layout_assignment.name()),
+            RO_property(ov::intel_cpu::mha_fusion.name()),
+            RO_property(ov::intel_cpu::reorders_report.name()),
         };
     }
 
@@ -355,6 +530,37 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::shape_buckets) {
+        return decltype(ov::intel_cpu::shape_buckets)::value_type(config.shapeBucketsStr);
+    } else if (name == ov::intel_cpu::shape_buckets_statistics) {
+        decltype(ov::intel_cpu::shape_buckets_statistics)::value_type statistics;
+        for (const auto& bucket : _shapeBuckets) {
+            statistics[bucket->name] = bucket->hits;
+        }
+        statistics["dynamic"] = _shapeBucketsMisses;
+        return statistics;
+    } else if (name == ov::intel_cpu::perf_sampling_rate) {
+        return decltype(ov::intel_cpu::perf_sampling_rate)::value_type(config.perfSamplingRate);
+    } else if (name == ov::intel_cpu::perf_samples) {
+        return decltype(ov::intel_cpu::perf_samples)::value_type(_perfSamples->dump());
+    } else if (name == ov::intel_cpu::profile_transformations) {
+        return decltype(ov::intel_cpu::profile_transformations)::value_type(config.profileTransformations);
+    } else if (name == ov::intel_cpu::transformations_profile) {
+        return decltype(ov::intel_cpu::transformations_profile)::value_type(_transformationsProfile);
+    } else if (name == ov::intel_cpu::memory_allocator) {
+        return decltype(ov::intel_cpu::memory_allocator)::value_type(config.memoryAllocator);
+    } else if (name == ov::intel_cpu::primitives_autotuning) {
+        return decltype(ov::intel_cpu::primitives_autotuning)::value_type(config.primitivesAutotuning);
+    } else if (name == ov::intel_cpu::depth_first_tiling) {
+        return decltype(ov::intel_cpu::depth_first_tiling)::value_type(config.depthFirstTiling);
+    } else if (name == ov::intel_cpu::intra_request_streams) {
+        return decltype(ov::intel_cpu::intra_request_streams)::value_type(config.intraRequestStreams);
+    } else if (name == ov::intel_cpu::layout_assignment) {
+        return decltype(ov::intel_cpu::layout_assignment)::value_type(config.layoutAssignment);
+    } else if (name == ov::intel_cpu::mha_fusion) {
+        return decltype(ov::intel_cpu::mha_fusion)::value_type(config.mhaFusion);
+    } else if (name == ov::intel_cpu::reorders_report) {
+        return decltype(ov::intel_cpu::reorders_report)::value_type(graph.getReordersReport().toJson());
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
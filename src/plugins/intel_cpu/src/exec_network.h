@@ -8,6 +8,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 
 #include "graph.h"
+#include "cpu_allocator.h"
 #include "extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
@@ -36,10 +37,13 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const std::string& transformationsProfile = {});
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -69,11 +73,45 @@ protected:
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                           _numaNodesWeights;
 
+    // Static graphs specialized for the input shapes declared via ov::intel_cpu::shape_buckets
+    struct ShapeBucket {
+        std::string                                     name;
+        std::map<std::string, InferenceEngine::SizeVector> inputShapes;
+        // the model reshaped to inputShapes, the graphs of all streams are replicated from it
+        std::shared_ptr<const ov::Model>                model;
+        // WARNING: Do not use graphs directly.
+        mutable std::deque<GraphGuard>                  graphs;
+        // weights are not shared with other buckets since constant subgraphs may depend on shapes
+        mutable NumaNodesWeights                        numaNodesWeights;
+        mutable std::atomic<uint64_t>                   hits{0};
+    };
+    std::vector<std::unique_ptr<ShapeBucket>>   _shapeBuckets;
+    // the model reshaped to the upper bound of the dynamic batch, shared by the graphs of all streams
+    std::shared_ptr<const ov::Model>            _upperBoundModel;
+    mutable std::atomic<uint64_t>               _shapeBucketsMisses{0};
+
+    std::shared_ptr<PerfSamples>                _perfSamples = std::make_shared<PerfSamples>();
+
+    // JSON report of transformations applied during compilation, see ov::intel_cpu::transformations_profile
+    const std::string                           _transformationsProfile;
+
+    // allocator of infer request blobs, nullptr for the default one, see ov::intel_cpu::memory_allocator
+    std::shared_ptr<InferenceEngine::IAllocator> _blobAllocator;
+
+    // selects primitive descriptors of all graphs by measured time, see ov::intel_cpu::primitives_autotuning
+    PrimitiveTunerPtr                           _primitiveTuner;
+
+    // runs independent nodes of an inference concurrently, see ov::intel_cpu::intra_request_streams
+    InferenceEngine::ITaskExecutor::Ptr         _intraRequestExecutor;
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
-    GraphGuard::Lock GetGraph() const;
+    GraphGuard::Lock GetGraph(const ShapeBucket* bucket = nullptr) const;
+
+    void CreateShapeBuckets(const std::shared_ptr<const ov::Model>& function);
+    const ShapeBucket* FindShapeBucket(const InferenceEngine::BlobMap& inputs) const;
 
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
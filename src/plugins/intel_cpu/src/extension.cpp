@@ -5,6 +5,7 @@
 #include "extension.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/mha.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 
@@ -38,6 +39,7 @@ std::map<std::string, ngraph::OpSet> Extension::getOpSets() {
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
         NGRAPH_OP(FullyConnectedNode, ov::intel_cpu)
         NGRAPH_OP(LeakyReluNode, ov::intel_cpu)
+        NGRAPH_OP(MHANode, ov::intel_cpu)
         NGRAPH_OP(PowerStaticNode, ov::intel_cpu)
         NGRAPH_OP(SwishNode, ov::intel_cpu)
 #undef NGRAPH_OP
@@ -48,6 +48,7 @@
 #include <ngraph/ops.hpp>
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
+#include <openvino/core/compilation_monitor.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 
 using namespace dnnl;
@@ -154,6 +155,7 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const Ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setPrimitiveTuner(primitiveTuner);
 
         graphNodes.push_back(node);
 
@@ -214,25 +216,9 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
 
     this->_name = network.getName();
 
-    std::shared_ptr<const ov::Model> func = nullptr;
-    // we perform model cloning and reshaping on Replicate stage to preserve input/output information
-    // it help to perform a graph compilation like in static case
-    // and handle dynamic batch case in inference stage with minimal code changes
-    if (config.isNewApi && config.batchLimit > 0) {
-        auto upperBoundModel = ngraph::clone_function(*network.getFunction());
-        std::map<ov::Output<ov::Node>, ov::PartialShape> newInShape;
-        for (const auto& in : upperBoundModel->get_parameters()) {
-            auto newShape = in->get_output_partial_shape(0);
-            newShape[0] = config.batchLimit;
-            newInShape[in] = newShape;
-        }
-        upperBoundModel->reshape(newInShape);
-
-        func = upperBoundModel;
-    } else {
-        func = network.getFunction();
-    }
-
+    // the model reshaped to the specialized input shapes or to the upper bound of the dynamic batch helps to perform
+    // a graph compilation like in static case and handle dynamic batch case in inference stage with minimal code changes
+    std::shared_ptr<const ov::Model> func = specializedModel ? specializedModel : network.getFunction();
     if (!func) {
         IE_THROW() << "Function pointer inside CNNNetwork is nullptr";
     }
@@ -266,6 +252,7 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setPrimitiveTuner(primitiveTuner);
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::get_type_info_static()) {
@@ -380,24 +367,38 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
 
 void Graph::InitGraph() {
     GraphOptimizer optimizer;
+    // stages of the graph initialization are check points of the compilation cancellation
+    const auto monitor = ov::CompilationMonitor::get_current();
+    auto checkCancelled = [&] {
+        if (monitor)
+            monitor->check_cancelled();
+    };
 
     SortTopologically();
     InitNodes();
+    checkCancelled();
 
     optimizer.ApplyCommonGraphOptimizations(*this);
     SortTopologically();
+    checkCancelled();
 
     InitDescriptors();
 
     InitOptimalPrimitiveDescriptors();
+    checkCancelled();
 
     InitEdges();
 
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
+    if (config.intraRequestStreams > 1 && intraRequestExecutor)
+        SortByWaves();
+    checkCancelled();
 
     Allocate();
 
+    if (monitor)
+        monitor->report(ov::CompilationStage::WEIGHTS_REORDER);
     CreatePrimitives();
 
 #ifndef CPU_DEBUG_CAPS
@@ -407,6 +408,12 @@ void Graph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    const bool hasConcurrentNodes = std::any_of(executableWaves.begin(), executableWaves.end(),
+                                                [](const std::vector<NodePtr>& wave) { return wave.size() > 1; });
+    if (!hasConcurrentNodes) {
+        executableWaves.clear();
+    }
+
     ExecuteConstantNodesOnly();
 }
 
@@ -448,6 +455,12 @@ void Graph::InitDescriptors() {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    reordersReport.greedy = LayoutAssignment::estimate(graphNodes);
+    // descriptors measured by the primitive tuner are kept as is
+    if (config.layoutAssignment && !primitiveTuner)
+        LayoutAssignment::optimize(graphNodes);
+    reordersReport.optimized = LayoutAssignment::estimate(graphNodes);
 }
 
 void Graph::InitOptimalPrimitiveDescriptors() {
@@ -473,6 +486,16 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (!execWaveBounds.empty()) {
+        for (const auto& node : executableGraphNodes) {
+            if (executableWaves.empty() ||
+                execWaveBounds[executableWaves.back().front()->execIndex].first != execWaveBounds[node->execIndex].first) {
+                executableWaves.emplace_back();
+            }
+            executableWaves.back().push_back(node);
+        }
+    }
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -542,6 +565,7 @@ void Graph::InitEdges() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitEdges");
 
     size_t numberOfEdges = graphEdges.size();
+    reordersReport.inserted = 0;
 
     std::unordered_set<std::string> uniqueLayerNames;
     for (auto node : graphNodes) {
@@ -562,6 +586,7 @@ void Graph::InitEdges() {
 
         // optimized flag indicate that just desc update w/o actual physical memory movement.
         InsertReorder(edge, layerName, edge->getInputDesc(), edge->getOutputDesc(), isOptimized);
+        reordersReport.inserted++;
     };
 
     auto updateEdge = [&](int& i) {
@@ -699,6 +724,11 @@ void Graph::AllocateWithReuse() {
         for (auto &edge : edge_clusters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
+            // nodes of a wave are executed concurrently, so the tensor lives during the whole waves of its nodes
+            if (!execWaveBounds.empty()) {
+                e_start = execWaveBounds[e_start].first;
+                e_finish = execWaveBounds[e_finish].second;
+            }
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -827,7 +857,11 @@ void Graph::Allocate() {
 
 void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
+    const auto monitor = ov::CompilationMonitor::get_current();
     for (auto& node : graphNodes) {
+        // weights of heavy nodes are reordered here, so cancellation is checked for every node
+        if (monitor)
+            monitor->check_cancelled();
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
         DEBUG_LOG(*node);
         node->createPrimitive();
@@ -996,25 +1030,112 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     DEBUG_LOG(*node);
 }
 
-void Graph::Infer(InferRequestBase* request) {
-    if (!IsReady()) {
-        IE_THROW() << "Wrong state. Topology is not ready.";
+void Graph::ExecuteNodeSampled(const NodePtr& node, const dnnl::stream& stream, uint64_t inferId,
+                               std::chrono::high_resolution_clock::time_point inferStart) const {
+    const auto start = std::chrono::high_resolution_clock::now();
+    ExecuteNode(node, stream);
+    const auto finish = std::chrono::high_resolution_clock::now();
+
+    auto memSize = [](const EdgePtr& edge) -> size_t {
+        const auto size = edge->getMemory().getDesc().getCurrentMemSize();
+        return size == MemoryDesc::UNDEFINED_SIZE ? 0 : size;
+    };
+    size_t bytes = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        bytes += memSize(node->getParentEdgeAt(i));
+    }
+    for (size_t port = 0; port < node->outputShapes.size(); port++) {
+        const auto edges = node->getChildEdgesAtPort(port);
+        if (!edges.empty())
+            bytes += memSize(edges[0]);
     }
 
-    dnnl::stream stream(eng);
+    auto toNs = [](std::chrono::high_resolution_clock::duration duration) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+    perfSamples->push({inferId, node->getName(), node->typeStr, node->getPrimitiveDescriptorType(),
+                       toNs(finish - start), bytes, toNs(start - inferStart)});
+}
 
+template <typename ExecuteNodeFunc>
+void Graph::ExecuteNodes(InferRequestBase* request, const ExecuteNodeFunc& executeNode) const {
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
         PERF(node, config.collectPerfCounters);
 
         if (request)
             request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+        executeNode(node);
+    }
+}
+
+void Graph::Infer(InferRequestBase* request) {
+    if (!IsReady()) {
+        IE_THROW() << "Wrong state. Topology is not ready.";
+    }
+
+    dnnl::stream stream(eng);
+
+    const bool sampled = perfSamples && config.perfSamplingRate > 0 &&
+                         perfSamplingCounter++ % config.perfSamplingRate == 0;
+    if (sampled) {
+        const auto inferId = perfSamples->nextInferId();
+        const auto inferStart = std::chrono::high_resolution_clock::now();
+        auto executeNode = [&](const NodePtr& node, const dnnl::stream& nodeStream) {
+            ExecuteNodeSampled(node, nodeStream, inferId, inferStart);
+        };
+        if (!executableWaves.empty()) {
+            ExecuteWaves(request, stream, executeNode);
+        } else {
+            ExecuteNodes(request, [&](const NodePtr& node) {
+                executeNode(node, stream);
+            });
+        }
+    } else if (!executableWaves.empty()) {
+        ExecuteWaves(request, stream, [this](const NodePtr& node, const dnnl::stream& nodeStream) {
+            ExecuteNode(node, nodeStream);
+        });
+    } else {
+        ExecuteNodes(request, [&](const NodePtr& node) {
+            ExecuteNode(node, stream);
+        });
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+template <typename ExecuteNodeFunc>
+void Graph::ExecuteWaves(InferRequestBase* request, const dnnl::stream& stream, const ExecuteNodeFunc& executeNode) const {
+    std::vector<InferenceEngine::Task> tasks;
+    for (const auto& wave : executableWaves) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (wave.size() == 1) {
+            const auto& node = wave.front();
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            executeNode(node, stream);
+            continue;
+        }
+
+        const size_t groups = std::min(static_cast<size_t>(config.intraRequestStreams), wave.size());
+        tasks.resize(groups);
+        for (size_t group = 0; group < groups; group++) {
+            tasks[group] = [this, &wave, &executeNode, group, groups] {
+                dnnl::stream groupStream(eng);
+                for (size_t i = group; i < wave.size(); i += groups) {
+                    const auto& node = wave[i];
+                    VERBOSE(node, config.verbose);
+                    PERF(node, config.collectPerfCounters);
+                    executeNode(node, groupStream);
+                }
+            };
+        }
+        intraRequestExecutor->runAndWait(tasks);
+    }
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1101,6 +1222,44 @@ void Graph::SortTopologically() {
     }
 }
 
+void Graph::SortByWaves() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::SortByWaves");
+
+    execWaveBounds.clear();
+    // memory nodes are ordered by their pairing rather than by edges, dynamic nodes may reallocate shared memory
+    for (const auto& node : graphNodes) {
+        if (node->isDynamicNode() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput))
+            return;
+    }
+
+    // the wave of a node is the length of the longest path from the graph inputs to the node,
+    // so nodes of the same wave don't depend on each other
+    std::unordered_map<const Node*, int> waves;
+    for (const auto& node : graphNodes) {
+        int wave = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            wave = std::max(wave, waves[node->getParentEdgeAt(i)->getParent().get()] + 1);
+        }
+        waves[node.get()] = wave;
+    }
+
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [&waves](const NodePtr& lhs, const NodePtr& rhs) {
+        return waves[lhs.get()] < waves[rhs.get()];
+    });
+
+    const int nodesCount = static_cast<int>(graphNodes.size());
+    execWaveBounds.resize(nodesCount);
+    for (int first = 0, last = 0; first < nodesCount; first = last + 1) {
+        last = first;
+        while (last + 1 < nodesCount && waves[graphNodes[last + 1].get()] == waves[graphNodes[first].get()])
+            last++;
+        for (int i = first; i <= last; i++) {
+            graphNodes[i]->execIndex = i;
+            execWaveBounds[i] = {first, last};
+        }
+    }
+}
+
 void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const NodePtr&)>
@@ -1385,6 +1544,7 @@ void Graph::EnforceBF16() {
                     Type::RNNCell,        // recurent nets
                     Type::RNNSeq,         // recurent nets
                     Type::MatMul,         // bert nets
+                    Type::MHA,            // bert nets
                     Type::ROIPooling,     // object detection nets
                     Type::Interpolate))    // super resolution nets
                 continue;   // stop at significant nodes
@@ -11,6 +11,9 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "layout_assignment.h"
+#include "perf_count.h"
+#include <threading/ie_itask_executor.hpp>
 #include <map>
 #include <string>
 #include <vector>
@@ -50,6 +53,48 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Model the graph is replicated from instead of the model of the network, e.g. the model reshaped to the
+     * static input shapes of a shape bucket or to the upper bound of the dynamic batch.
+     * @param model
+     * reshaped model, created once by the compiled model and shared by the graphs of all streams
+     */
+    void setSpecializedModel(const std::shared_ptr<const ov::Model>& model) {
+        specializedModel = model;
+    }
+
+    /**
+     * @brief Ring buffer receiving per node samples of every config.perfSamplingRate-th inference.
+     * @param samples
+     * buffer shared between graphs of the compiled model
+     */
+    void setPerfSamples(const std::shared_ptr<PerfSamples>& samples) {
+        perfSamples = samples;
+    }
+
+    /**
+     * @brief Tuner which selects primitive descriptors of the graph nodes by measured execution time.
+     * Graphs of the same compiled model share the tuner. Nodes use the static priority if none is set.
+     */
+    void setPrimitiveTuner(const PrimitiveTunerPtr& tuner) {
+        primitiveTuner = tuner;
+    }
+
+    /**
+     * @brief Executor with config.intraRequestStreams streams running independent nodes of an inference concurrently.
+     * It is owned by the compiled model and shared by its graphs. Nodes are executed one by one if none is set.
+     */
+    void setIntraRequestExecutor(const InferenceEngine::ITaskExecutor::Ptr& executor) {
+        intraRequestExecutor = executor;
+    }
+
+    /**
+     * @brief Reorders estimated before and after the graph wide layout assignment and inserted into the graph
+     */
+    const LayoutAssignment::Report& getReordersReport() const {
+        return reordersReport;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
@@ -208,6 +253,8 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        execWaveBounds.clear();
+        executableWaves.clear();
     }
     Status status { NotReady };
     Config config;
@@ -216,6 +263,9 @@ protected:
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    std::shared_ptr<PerfSamples> perfSamples;
+    uint64_t perfSamplingCounter = 0;
+
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
@@ -229,6 +279,8 @@ protected:
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
 
+    std::shared_ptr<const ov::Model> specializedModel;
+
     static dnnl::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const ExtensionManager::Ptr& extMgr);
@@ -243,7 +295,14 @@ protected:
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
+    void ExecuteNodeSampled(const NodePtr& node, const dnnl::stream& stream, uint64_t inferId,
+                            std::chrono::high_resolution_clock::time_point inferStart) const;
+    template <typename ExecuteNodeFunc>
+    void ExecuteNodes(InferRequestBase* request, const ExecuteNodeFunc& executeNode) const;
     void ExecuteConstantNodesOnly() const;
+    void SortByWaves();
+    template <typename ExecuteNodeFunc>
+    void ExecuteWaves(InferRequestBase* request, const dnnl::stream& stream, const ExecuteNodeFunc& executeNode) const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -261,7 +320,15 @@ private:
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
 
+    // exec indexes of the first and the last node of the wave of every node, empty if nodes are executed one by one;
+    // nodes of a wave don't depend on each other and are executed concurrently by config.intraRequestStreams groups
+    std::vector<std::pair<int, int>> execWaveBounds;
+    std::vector<std::vector<NodePtr>> executableWaves;
+    InferenceEngine::ITaskExecutor::Ptr intraRequestExecutor;
+
     MultiCachePtr rtParamsCache;
+    PrimitiveTunerPtr primitiveTuner;
+    LayoutAssignment::Report reordersReport;
 
     void EnforceBF16();
 };
@@ -92,6 +92,12 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+InferenceEngine::Blob::Ptr InferRequestBase::createBlob(const InferenceEngine::TensorDesc& desc) const {
+    if (execNetwork->_blobAllocator)
+        return make_blob_with_precision(desc, execNetwork->_blobAllocator);
+    return make_blob_with_precision(desc);
+}
+
 void InferRequestBase::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
@@ -152,8 +158,10 @@ void InferRequestBase::redefineMemoryForInputNodes() {
 void InferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    auto graphLock = execNetwork->GetGraph(execNetwork->FindShapeBucket(_inputs));
     graph = &(graphLock._graph);
+    // memory of dynamic shapes is reallocated during inference
+    CpuAllocator::Scope allocatorScope(graph->getConfig().memoryAllocator);
 
     ThrowIfCanceled();
     convertBatchedInputBlobs();
@@ -506,7 +514,7 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
+            _inputs[name] = createBlob(desc);
             _inputs[name]->allocate();
             if (pBlobDesc == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
@@ -548,7 +556,7 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
+                data = createBlob(desc);
                 data->allocate();
             } else {
                 const auto& expectedTensorDesc = pBlobDesc;
@@ -779,7 +787,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
+                _inputs[name] = createBlob(desc);
                 _inputs[name]->allocate();
 
                 if (!isDynamic &&
@@ -814,7 +822,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
+                    data = createBlob(desc);
                     data->allocate();
                 } else {
                     const auto& blobDims = data->getTensorDesc().getDims();
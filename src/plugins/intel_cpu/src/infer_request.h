@@ -51,6 +51,7 @@ protected:
     void CreateInferRequest();
     InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    InferenceEngine::Blob::Ptr createBlob(const InferenceEngine::TensorDesc& desc) const;
 
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
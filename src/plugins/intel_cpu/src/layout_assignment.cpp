@@ -0,0 +1,180 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layout_assignment.h"
+
+#include "edge.h"
+#include "utils/debug_capabilities.h"
+
+#include <set>
+#include <sstream>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// sweeps over the graph stop earlier if none of the nodes changes its descriptor
+constexpr int maxSweeps = 4;
+
+// estimated amount of data reordered on the edge if the parent and the child use the given descriptors
+size_t reorderCost(const EdgePtr& edge, const NodeDesc* parentPd, const NodeDesc* childPd) {
+    if (parentPd == nullptr || childPd == nullptr)
+        return 0;
+    auto parent = edge->getParent();
+    if (parent->isConstant())
+        return 0;
+    const auto& outConfs = parentPd->getConfig().outConfs;
+    const auto& inConfs = childPd->getConfig().inConfs;
+    const int outNum = edge->getInputNum();
+    const int inNum = edge->getOutputNum();
+    if (outNum < 0 || outNum >= outConfs.size() || inNum < 0 || inNum >= inConfs.size())
+        return 0;
+    if (inConfs[inNum].getMemDesc()->isCompatible(*outConfs[outNum].getMemDesc()))
+        return 0;
+    const auto& shape = parent->getOutputShapeAtPort(outNum);
+    return shape.isStatic() ? shape.getElementsCount() : 1;
+}
+
+// execution cost of an output element relative to the cost of reordering it
+size_t implementationWeight(impl_desc_type type) {
+    if (type & impl_desc_type::ref)
+        return 16;
+    if (type & (impl_desc_type::jit | impl_desc_type::brgconv | impl_desc_type::brgemm))
+        return 1;
+    if (type & impl_desc_type::gemm)
+        return 4;
+    return 2;
+}
+
+// cost of executing the node with the implementation of the descriptor, switching to another implementation than
+// the one selected by the node is penalized, so it is done only if it saves more reorders than the node computes
+size_t implementationCost(const NodePtr& node, const NodeDesc* pd) {
+    size_t elements = 0;
+    for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++) {
+        const auto& shape = node->getOutputShapeAtPort(i);
+        elements += shape.isStatic() ? shape.getElementsCount() : 1;
+    }
+    const auto type = pd->getImplementationType();
+    const bool switched = type != node->getSelectedPrimitiveDescriptor()->getImplementationType();
+    return elements * (implementationWeight(type) + (switched ? 1 : 0));
+}
+
+// cost of all edges of the node and of its implementation if it uses the given descriptor
+size_t nodeCost(const NodePtr& node, const NodeDesc* pd) {
+    size_t cost = implementationCost(node, pd);
+    for (const auto& weakEdge : node->getParentEdges()) {
+        auto edge = weakEdge.lock();
+        if (edge)
+            cost += reorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), pd);
+    }
+    for (const auto& weakEdge : node->getChildEdges()) {
+        auto edge = weakEdge.lock();
+        if (edge)
+            cost += reorderCost(edge, pd, edge->getChild()->getSelectedPrimitiveDescriptor());
+    }
+    return cost;
+}
+
+bool hasInPlacePorts(const NodeConfig& config) {
+    for (const auto& conf : config.inConfs) {
+        if (conf.inPlace() >= 0)
+            return true;
+    }
+    for (const auto& conf : config.outConfs) {
+        if (conf.inPlace() >= 0)
+            return true;
+    }
+    return false;
+}
+
+// descriptors which can replace the selected one
+std::vector<size_t> getCandidates(const NodePtr& node) {
+    // these nodes select their descriptors with respect to in-place memory or subgraphs
+    static const std::set<Type> skippedTypes = {
+        Type::Input, Type::Output, Type::Reorder, Type::Concatenation, Type::Split,
+        Type::MemoryInput, Type::MemoryOutput, Type::If, Type::TensorIterator};
+
+    std::vector<size_t> candidates;
+    const auto selected = node->getSelectedPrimitiveDescriptor();
+    if (selected == nullptr || skippedTypes.count(node->getType()) || node->isConstant() ||
+        hasInPlacePorts(selected->getConfig()))
+        return candidates;
+
+    const auto& supported = node->getSupportedPrimitiveDescriptors();
+    for (size_t i = 0; i < supported.size(); i++) {
+        const auto& config = supported[i].getConfig();
+        if (config.inConfs.size() != selected->getConfig().inConfs.size() ||
+            config.outConfs.size() != selected->getConfig().outConfs.size() ||
+            config.inConfs.size() > node->getParentEdges().size() ||
+            hasInPlacePorts(config))
+            continue;
+        candidates.push_back(i);
+    }
+    return candidates;
+}
+
+}   // namespace
+
+std::string LayoutAssignment::Report::toJson() const {
+    std::stringstream ss;
+    ss << "{\"greedy_reorders\":" << greedy.reorders
+       << ",\"greedy_reorder_elements\":" << greedy.reorderElements
+       << ",\"optimized_reorders\":" << optimized.reorders
+       << ",\"optimized_reorder_elements\":" << optimized.reorderElements
+       << ",\"inserted_reorders\":" << inserted << "}";
+    return ss.str();
+}
+
+LayoutAssignment::Statistics LayoutAssignment::estimate(const std::vector<NodePtr>& nodes) {
+    Statistics statistics;
+    for (const auto& node : nodes) {
+        for (const auto& weakEdge : node->getChildEdges()) {
+            auto edge = weakEdge.lock();
+            if (!edge)
+                continue;
+            const auto cost = reorderCost(edge, node->getSelectedPrimitiveDescriptor(),
+                                          edge->getChild()->getSelectedPrimitiveDescriptor());
+            if (cost > 0) {
+                statistics.reorders++;
+                statistics.reorderElements += cost;
+            }
+        }
+    }
+    return statistics;
+}
+
+void LayoutAssignment::optimize(const std::vector<NodePtr>& nodes) {
+    for (int sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (const auto& node : nodes) {
+            const auto candidates = getCandidates(node);
+            if (candidates.size() < 2)
+                continue;
+
+            const auto& supported = node->getSupportedPrimitiveDescriptors();
+            const auto currentCost = nodeCost(node, node->getSelectedPrimitiveDescriptor());
+            size_t bestCost = currentCost;
+            int best = -1;
+            for (auto i : candidates) {
+                const auto cost = nodeCost(node, &supported[i]);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    best = static_cast<int>(i);
+                }
+            }
+            // every switch strictly decreases the cost of the graph, so the sweeps converge
+            if (best >= 0) {
+                DEBUG_LOG(node->getName(), " switches to pd[", best, "], cost ", currentCost, " -> ", bestCost);
+                node->selectPrimitiveDescriptorByIndex(best);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
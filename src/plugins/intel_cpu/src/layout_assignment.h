@@ -0,0 +1,54 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Graph wide refinement of the primitive descriptors selected node by node.
+ * The cost of the graph is the estimated amount of reordered data on edges where the selected layouts
+ * of the parent and the child do not match, plus the output elements of every node weighted by its
+ * implementation type (reference implementations are the most expensive ones). Nodes are revisited in
+ * topological order and switched to another supported descriptor if it decreases the cost of the node
+ * and the edges around it, until no node can be improved. Edges from constant nodes cost nothing, as their
+ * reorders are executed once on graph creation.
+ */
+class LayoutAssignment {
+public:
+    struct Statistics {
+        // edges which require reorders
+        size_t reorders = 0;
+        // elements reordered by them, dynamic edges count as one element
+        size_t reorderElements = 0;
+    };
+
+    /**
+     * @brief Reorders estimated from the descriptors selected by nodes and after the refinement
+     * and the number of reorders actually inserted into the graph
+     */
+    struct Report {
+        Statistics greedy;
+        Statistics optimized;
+        size_t inserted = 0;
+
+        std::string toJson() const;
+    };
+
+    static Statistics estimate(const std::vector<NodePtr>& nodes);
+
+    /**
+     * @brief Changes the selected primitive descriptors of the nodes, the nodes must be sorted topologically
+     */
+    static void optimize(const std::vector<NodePtr>& nodes);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
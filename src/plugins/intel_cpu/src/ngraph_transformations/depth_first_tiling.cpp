@@ -0,0 +1,329 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "depth_first_tiling.hpp"
+#include "op/leaky_relu.hpp"
+#include "op/power_static.hpp"
+#include "op/swish_cpu.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/op/util/binary_elementwise_arithmetic.hpp>
+#include <ngraph/op/util/unary_elementwise_arithmetic.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "itt.hpp"
+
+namespace {
+
+constexpr size_t heightAxis = 2;
+// smaller bands make the overhead of the halo and of the calls of the primitives too high
+constexpr size_t minBandRows = 8;
+// rows of the chain input computed twice by the neighbouring bands, relative to its height
+constexpr double maxHaloOverhead = 0.5;
+
+// how the rows of the output of the operation are computed from the rows of its input
+struct Window {
+    size_t kernel = 1;    // including dilation
+    size_t stride = 1;
+    size_t padBegin = 0;
+    size_t padEnd = 0;
+};
+
+struct ChainNode {
+    std::shared_ptr<ngraph::Node> node;
+    size_t inputIdx = 0;
+    Window window;
+};
+
+// rows of a tensor of the chain computed for a band and the paddings of the operation consuming them
+struct BandRows {
+    size_t begin = 0;
+    size_t end = 0;
+    size_t padBegin = 0;
+    size_t padEnd = 0;
+};
+
+bool isStatic4D(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_partial_shape().is_static() && output.get_shape().size() == 4;
+}
+
+// the constant is broadcasted along the height of the 4D tensor
+bool isHeightInvariantConstant(const ngraph::Output<ngraph::Node>& output) {
+    if (!ngraph::op::is_constant(output.get_node()))
+        return false;
+    const auto& shape = output.get_shape();
+    const auto heightFromEnd = 4 - heightAxis;
+    return shape.size() < heightFromEnd || shape[shape.size() - heightFromEnd] == 1;
+}
+
+bool isElementwise(const std::shared_ptr<ngraph::Node>& node) {
+    return std::dynamic_pointer_cast<ngraph::op::util::UnaryElementwiseArithmetic>(node) ||
+           std::dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node) ||
+           ngraph::is_type<ngraph::opset1::Clamp>(node) ||
+           ngraph::is_type<ngraph::opset1::Elu>(node) ||
+           ngraph::is_type<ngraph::opset1::PRelu>(node) ||
+           ngraph::is_type<ngraph::opset1::FakeQuantize>(node) ||
+           ngraph::is_type<ngraph::opset1::Convert>(node) ||
+           ngraph::is_type<ngraph::opset4::Swish>(node) ||
+           ngraph::is_type<ov::intel_cpu::SwishNode>(node) ||
+           ngraph::is_type<ov::intel_cpu::LeakyReluNode>(node) ||
+           ngraph::is_type<ov::intel_cpu::PowerStaticNode>(node);
+}
+
+template <typename Op, typename Pads>
+void getPads(const std::shared_ptr<Op>& op, Pads& padsBegin, Pads& padsEnd) {
+    padsBegin = op->get_pads_begin();
+    padsEnd = op->get_pads_end();
+    if (op->get_auto_pad() == ngraph::op::PadType::VALID) {
+        std::fill(padsBegin.begin(), padsBegin.end(), 0);
+        std::fill(padsEnd.begin(), padsEnd.end(), 0);
+    }
+}
+
+template <typename Conv>
+bool getConvolutionWindow(const std::shared_ptr<Conv>& conv, Window& window) {
+    if (!ngraph::op::is_constant(conv->get_input_node_ptr(1)))
+        return false;
+    ngraph::CoordinateDiff padsBegin, padsEnd;
+    getPads(conv, padsBegin, padsEnd);
+    if (padsBegin[0] < 0 || padsEnd[0] < 0)
+        return false;
+    const auto& weightsShape = conv->get_input_shape(1);
+    window.kernel = (weightsShape[weightsShape.size() - 2] - 1) * conv->get_dilations()[0] + 1;
+    window.stride = conv->get_strides()[0];
+    window.padBegin = static_cast<size_t>(padsBegin[0]);
+    window.padEnd = static_cast<size_t>(padsEnd[0]);
+    return true;
+}
+
+// the operations of the bands use the floor rounding, so the ceil one is supported only if the output width
+// is the same and the rows out of the input are not counted by the average
+template <typename Pool>
+bool getPoolingWindow(const std::shared_ptr<Pool>& pool, bool excludePad, Window& window) {
+    ngraph::Shape padsBegin, padsEnd;
+    getPads(pool, padsBegin, padsEnd);
+    const auto& kernel = pool->get_kernel();
+    const auto& strides = pool->get_strides();
+    const auto& inShape = pool->get_input_shape(0);
+    const auto& outShape = pool->get_output_shape(0);
+    if (pool->get_rounding_type() == ngraph::op::RoundingType::CEIL) {
+        auto floorSize = [&](size_t dim) {
+            return (inShape[dim + 2] + padsBegin[dim] + padsEnd[dim] - kernel[dim]) / strides[dim] + 1;
+        };
+        if (floorSize(1) != outShape[3] || (!excludePad && floorSize(0) != outShape[2]))
+            return false;
+    }
+    window.kernel = kernel[0];
+    window.stride = strides[0];
+    window.padBegin = padsBegin[0];
+    window.padEnd = padsEnd[0];
+    return true;
+}
+
+bool getChainNode(const std::shared_ptr<ngraph::Node>& node, ChainNode& chainNode) {
+    if (node->get_output_size() != 1 || !isStatic4D(node->output(0)) || node->get_input_size() == 0)
+        return false;
+
+    chainNode.node = node;
+    chainNode.inputIdx = 0;
+    chainNode.window = Window();
+    if (!isStatic4D(node->input_value(0)))
+        return false;
+    if (const auto conv = ngraph::as_type_ptr<ngraph::opset1::Convolution>(node))
+        return getConvolutionWindow(conv, chainNode.window);
+    if (const auto conv = ngraph::as_type_ptr<ngraph::opset1::GroupConvolution>(node))
+        return getConvolutionWindow(conv, chainNode.window);
+    if (const auto pool = ngraph::as_type_ptr<ngraph::opset1::MaxPool>(node))
+        return getPoolingWindow(pool, true, chainNode.window);
+    if (const auto pool = ngraph::as_type_ptr<ngraph::opset1::AvgPool>(node))
+        return getPoolingWindow(pool, pool->get_exclude_pad(), chainNode.window);
+
+    if (!isElementwise(node))
+        return false;
+    // one input from the chain of the same shape as the output, the others are constants
+    bool found = false;
+    for (size_t i = 0; i < node->get_input_size(); i++) {
+        if (isHeightInvariantConstant(node->input_value(i)))
+            continue;
+        if (found || !isStatic4D(node->input_value(i)) || node->get_input_shape(i) != node->get_output_shape(0))
+            return false;
+        chainNode.inputIdx = i;
+        found = true;
+    }
+    return found;
+}
+
+template <typename Conv>
+std::shared_ptr<ngraph::Node> cloneConvolution(const std::shared_ptr<Conv>& conv, const ngraph::Output<ngraph::Node>& input,
+                                               const BandRows& rows) {
+    ngraph::CoordinateDiff padsBegin, padsEnd;
+    getPads(conv, padsBegin, padsEnd);
+    padsBegin[0] = static_cast<ptrdiff_t>(rows.padBegin);
+    padsEnd[0] = static_cast<ptrdiff_t>(rows.padEnd);
+    return std::make_shared<Conv>(input, conv->input_value(1), conv->get_strides(), padsBegin, padsEnd, conv->get_dilations(),
+                                  ngraph::op::PadType::EXPLICIT);
+}
+
+std::shared_ptr<ngraph::Node> cloneForBand(const ChainNode& chainNode, const ngraph::Output<ngraph::Node>& input,
+                                           const BandRows& rows) {
+    const auto& node = chainNode.node;
+    if (const auto conv = ngraph::as_type_ptr<ngraph::opset1::Convolution>(node))
+        return cloneConvolution(conv, input, rows);
+    if (const auto conv = ngraph::as_type_ptr<ngraph::opset1::GroupConvolution>(node))
+        return cloneConvolution(conv, input, rows);
+
+    ngraph::Shape padsBegin, padsEnd;
+    if (const auto pool = ngraph::as_type_ptr<ngraph::opset1::MaxPool>(node)) {
+        getPads(pool, padsBegin, padsEnd);
+        padsBegin[0] = rows.padBegin;
+        padsEnd[0] = rows.padEnd;
+        return std::make_shared<ngraph::opset1::MaxPool>(input, pool->get_strides(), padsBegin, padsEnd, pool->get_kernel(),
+                                                         ngraph::op::RoundingType::FLOOR, ngraph::op::PadType::EXPLICIT);
+    }
+    if (const auto pool = ngraph::as_type_ptr<ngraph::opset1::AvgPool>(node)) {
+        getPads(pool, padsBegin, padsEnd);
+        padsBegin[0] = rows.padBegin;
+        padsEnd[0] = rows.padEnd;
+        return std::make_shared<ngraph::opset1::AvgPool>(input, pool->get_strides(), padsBegin, padsEnd, pool->get_kernel(),
+                                                         pool->get_exclude_pad(), ngraph::op::RoundingType::FLOOR,
+                                                         ngraph::op::PadType::EXPLICIT);
+    }
+
+    auto inputs = node->input_values();
+    inputs[chainNode.inputIdx] = input;
+    return node->clone_with_new_inputs(inputs);
+}
+
+// rows of all tensors of the chain required to compute the rows [begin, end) of the output, from the input to the output
+std::vector<BandRows> getBandRows(const std::vector<ChainNode>& chain, const std::vector<size_t>& heights, size_t begin, size_t end) {
+    std::vector<BandRows> band(chain.size() + 1);
+    band.back().begin = begin;
+    band.back().end = end;
+    for (size_t i = chain.size(); i-- > 0;) {
+        const auto& window = chain[i].window;
+        const auto height = static_cast<ptrdiff_t>(heights[i]);
+        const auto inBegin = static_cast<ptrdiff_t>(band[i + 1].begin * window.stride) - static_cast<ptrdiff_t>(window.padBegin);
+        const auto inEnd = static_cast<ptrdiff_t>((band[i + 1].end - 1) * window.stride + window.kernel) -
+                           static_cast<ptrdiff_t>(window.padBegin);
+        band[i].begin = static_cast<size_t>(std::max<ptrdiff_t>(inBegin, 0));
+        band[i].end = static_cast<size_t>(std::min(inEnd, height));
+        band[i].padBegin = static_cast<size_t>(std::max<ptrdiff_t>(-inBegin, 0));
+        band[i].padEnd = static_cast<size_t>(std::max<ptrdiff_t>(inEnd - height, 0));
+    }
+    return band;
+}
+
+std::vector<std::vector<BandRows>> splitIntoBands(const std::vector<ChainNode>& chain, const std::vector<size_t>& heights,
+                                                  size_t bandsCount) {
+    std::vector<std::vector<BandRows>> bands;
+    const auto outHeight = heights.back();
+    const auto rows = (outHeight + bandsCount - 1) / bandsCount;
+    for (size_t begin = 0; begin < outHeight; begin += rows) {
+        bands.push_back(getBandRows(chain, heights, begin, std::min(begin + rows, outHeight)));
+    }
+    return bands;
+}
+
+bool tileChain(const std::vector<ChainNode>& chain, size_t cacheSize) {
+    const bool hasSpatialNode = std::any_of(chain.begin(), chain.end(), [](const ChainNode& chainNode) {
+        return chainNode.window.kernel > 1 || chainNode.window.stride > 1;
+    });
+    if (chain.size() < 2 || !hasSpatialNode || cacheSize == 0)
+        return false;
+
+    const auto& first = chain.front();
+    std::vector<size_t> heights{first.node->get_input_shape(first.inputIdx)[heightAxis]};
+    size_t totalSize = first.node->get_input_element_type(first.inputIdx).size() *
+                       ngraph::shape_size(first.node->get_input_shape(first.inputIdx));
+    for (const auto& chainNode : chain) {
+        heights.push_back(chainNode.node->get_output_shape(0)[heightAxis]);
+        totalSize += chainNode.node->get_output_element_type(0).size() * ngraph::shape_size(chainNode.node->get_output_shape(0));
+    }
+
+    size_t bandsCount = std::min((totalSize + cacheSize - 1) / cacheSize, heights.back() / minBandRows);
+    std::vector<std::vector<BandRows>> bands;
+    for (; bandsCount >= 2; bandsCount--) {
+        bands = splitIntoBands(chain, heights, bandsCount);
+        size_t inputRows = 0;
+        for (const auto& band : bands) {
+            inputRows += band.front().end - band.front().begin;
+        }
+        if (inputRows <= heights.front() * (1 + maxHaloOverhead))
+            break;
+    }
+    if (bandsCount < 2)
+        return false;
+
+    const auto input = first.node->input_value(first.inputIdx);
+    ngraph::NodeVector originalNodes;
+    for (const auto& chainNode : chain) {
+        originalNodes.push_back(chainNode.node);
+    }
+    ngraph::NodeVector newNodes;
+    ngraph::OutputVector bandOutputs;
+    for (size_t k = 0; k < bands.size(); k++) {
+        const auto& band = bands[k];
+        const auto suffix = "/band_" + std::to_string(k);
+        const auto begin = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{4},
+                                                            {0, 0, static_cast<int32_t>(band.front().begin), 0});
+        const auto end = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{4},
+                                                          {0, 0, static_cast<int32_t>(band.front().end), 0});
+        const std::vector<int64_t> mask{1, 1, 0, 1};
+        auto slice = std::make_shared<ngraph::opset1::StridedSlice>(input, begin, end, mask, mask);
+        slice->set_friendly_name(first.node->get_friendly_name() + suffix + "/slice");
+        newNodes.push_back(slice);
+
+        ngraph::Output<ngraph::Node> current = slice;
+        for (size_t i = 0; i < chain.size(); i++) {
+            auto tile = cloneForBand(chain[i], current, band[i]);
+            tile->set_friendly_name(chain[i].node->get_friendly_name() + suffix);
+            newNodes.push_back(tile);
+            current = tile->output(0);
+        }
+        bandOutputs.push_back(current);
+    }
+
+    const auto& last = chain.back().node;
+    auto concat = std::make_shared<ngraph::opset1::Concat>(bandOutputs, heightAxis);
+    concat->set_friendly_name(last->get_friendly_name());
+    newNodes.push_back(concat);
+    ngraph::copy_runtime_info(originalNodes, newNodes);
+    last->output(0).replace(concat->output(0));
+    return true;
+}
+
+}   // namespace
+
+bool ov::intel_cpu::DepthFirstTiling::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(DepthFirstTiling);
+    bool modified = false;
+    std::unordered_set<ngraph::Node*> visited;
+    for (const auto& node : model->get_ordered_ops()) {
+        // the nodes are sorted topologically, so the first visited node of a chain is its head
+        ChainNode head;
+        if (visited.count(node.get()) || !getChainNode(node, head))
+            continue;
+        visited.insert(node.get());
+
+        std::vector<ChainNode> chain{head};
+        while (true) {
+            const auto consumers = chain.back().node->get_output_target_inputs(0);
+            if (consumers.size() != 1)
+                break;
+            const auto& consumer = *consumers.begin();
+            const auto consumerNode = consumer.get_node()->shared_from_this();
+            ChainNode next;
+            if (visited.count(consumerNode.get()) || !getChainNode(consumerNode, next) || next.inputIdx != consumer.get_index())
+                break;
+            visited.insert(consumerNode.get());
+            chain.push_back(next);
+        }
+
+        modified |= tileChain(chain, cacheSize);
+    }
+    return modified;
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface DepthFirstTiling
+ * @brief Splits chains of spatially local operations (Convolution, GroupConvolution, MaxPool, AvgPool and element-wise
+ * operations with height invariant constant inputs) on 4D tensors into bands of rows, which are executed one after another
+ * through the whole chain. The bands of the chain input are sliced with the halo required by the windows of the chain,
+ * the results are concatenated along the height. The number of bands is selected so that the intermediate tensors of a
+ * band fit into the cache, so they are not streamed through the memory between the operations.
+ */
+class DepthFirstTiling : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("DepthFirstTiling", "0");
+    /**
+     * @param cacheSize size of the cache in bytes the intermediate tensors of a band should fit into
+     */
+    explicit DepthFirstTiling(size_t cacheSize) : ModelPass(), cacheSize(cacheSize) {}
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+
+private:
+    size_t cacheSize;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,150 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha_fusion.hpp"
+#include "op/mha.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "itt.hpp"
+
+namespace {
+
+bool has_single_consumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+// returns the value of the scalar floating point constant or false if the node is not such a constant
+bool get_scalar(const ngraph::Output<ngraph::Node>& output, float& value) {
+    const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1 || !constant->get_element_type().is_real())
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// Q * K^T optionally scaled
+bool is_scores(const ngraph::Node* node) {
+    if (ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node)) {
+        return ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_ptr(0)) ||
+               ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_ptr(1));
+    }
+    return ngraph::is_type<ngraph::opset1::MatMul>(node);
+}
+
+int64_t get_softmax_axis(const std::shared_ptr<ngraph::Node>& softmax) {
+    if (const auto softmax_v1 = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(softmax))
+        return static_cast<int64_t>(softmax_v1->get_axis());
+    const auto softmax_v8 = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(softmax);
+    auto axis = softmax_v8->get_axis();
+    return axis < 0 ? axis + softmax->get_output_partial_shape(0).rank().get_length() : axis;
+}
+
+}   // namespace
+
+ov::intel_cpu::MHAFusion::MHAFusion() {
+    MATCHER_SCOPE(MHAFusion);
+    auto softmax_m = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(
+        {ngraph::pattern::any_input()}, ngraph::pattern::has_static_rank());
+    auto v_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax_m, v_m});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto matmul_v = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output[matmul_m].get_node_shared_ptr());
+        auto softmax = pattern_to_output[softmax_m].get_node_shared_ptr();
+        if (!matmul_v || transformation_callback(matmul_v) || matmul_v->get_transpose_a() || matmul_v->get_transpose_b())
+            return false;
+
+        const auto rank = softmax->get_output_partial_shape(0).rank().get_length();
+        if (rank < 2 || get_softmax_axis(softmax) != rank - 1 || !has_single_consumer(softmax))
+            return false;
+
+        ngraph::NodeVector fused = {matmul_v, softmax};
+        auto node = softmax->get_input_node_shared_ptr(0);
+
+        ngraph::Output<ngraph::Node> mask;
+        const bool with_mask = ngraph::is_type<ngraph::opset1::Add>(node);
+        if (with_mask) {
+            if (!has_single_consumer(node))
+                return false;
+            // the mask is the input which is not produced by the scaled Q * K^T
+            const size_t scores_idx = is_scores(node->get_input_node_ptr(0)) ? 0 : 1;
+            mask = node->input_value(1 - scores_idx);
+            if (mask.get_partial_shape().rank().is_dynamic() || mask.get_partial_shape().rank().get_length() > rank)
+                return false;
+            // the mask is broadcasted into the scores, the scores themselves must not be broadcasted by the mask
+            const auto& scores_shape = node->get_input_partial_shape(scores_idx);
+            auto broadcasted_shape = scores_shape;
+            if (node->get_autob().m_type != ngraph::op::AutoBroadcastType::NUMPY ||
+                !ngraph::PartialShape::broadcast_merge_into(broadcasted_shape, mask.get_partial_shape(),
+                                                            ngraph::op::AutoBroadcastType::NUMPY) ||
+                !broadcasted_shape.same_scheme(scores_shape))
+                return false;
+            fused.push_back(node);
+            node = node->get_input_node_shared_ptr(scores_idx);
+        }
+
+        float scale = 1.f;
+        if (ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node)) {
+            float value = 0.f;
+            const bool is_divide = ngraph::is_type<ngraph::opset1::Divide>(node);
+            size_t scores_idx = 0;
+            if (get_scalar(node->input_value(1), value)) {
+                scores_idx = 0;
+            } else if (!is_divide && get_scalar(node->input_value(0), value)) {
+                scores_idx = 1;
+            } else {
+                return false;
+            }
+            if (!has_single_consumer(node) || (is_divide && value == 0.f))
+                return false;
+            scale = is_divide ? 1.f / value : value;
+            fused.push_back(node);
+            node = node->get_input_node_shared_ptr(scores_idx);
+        }
+
+        auto matmul_qk = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+        if (!matmul_qk || matmul_qk->get_transpose_a() || !has_single_consumer(matmul_qk))
+            return false;
+        fused.push_back(matmul_qk);
+
+        const auto& q = matmul_qk->input_value(0);
+        const auto& k = matmul_qk->input_value(1);
+        const auto& v = matmul_v->input_value(1);
+        const auto type = q.get_element_type();
+        if (type != ngraph::element::f32 && type != ngraph::element::bf16)
+            return false;
+        if (k.get_element_type() != type || v.get_element_type() != type ||
+            (with_mask && mask.get_element_type() != type))
+            return false;
+
+        // broadcasting of batch dimensions of Q, K and V is not supported
+        const auto& q_shape = q.get_partial_shape();
+        const auto& k_shape = k.get_partial_shape();
+        const auto& v_shape = v.get_partial_shape();
+        if (q_shape.rank().is_dynamic() || q_shape.rank().get_length() != rank ||
+            k_shape.rank().is_dynamic() || k_shape.rank().get_length() != rank ||
+            v_shape.rank().is_dynamic() || v_shape.rank().get_length() != rank)
+            return false;
+        for (int64_t i = 0; i < rank - 2; i++) {
+            if (!q_shape[i].same_scheme(k_shape[i]) || !q_shape[i].same_scheme(v_shape[i]))
+                return false;
+        }
+
+        const bool transpose_k = matmul_qk->get_transpose_b();
+        auto mha = with_mask ? std::make_shared<ov::intel_cpu::MHANode>(q, k, v, mask, scale, transpose_k)
+                             : std::make_shared<ov::intel_cpu::MHANode>(q, k, v, scale, transpose_k);
+        mha->set_friendly_name(matmul_v->get_friendly_name());
+        ngraph::copy_runtime_info(fused, mha);
+        ngraph::replace_node(matmul_v, mha);
+        MATCHER_SCOPE_ENABLE(MHAFusion);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,24 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface MHAFusion
+ * @brief Fuses MatMul(Q, K) -> [Multiply/Divide by scalar] -> [Add mask] -> Softmax -> MatMul(V) into MHANode,
+ * which is executed without storing the whole matrix of attention scores.
+ */
+class MHAFusion : public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MHAFusion", "0");
+    MHAFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
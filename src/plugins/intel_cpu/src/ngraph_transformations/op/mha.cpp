@@ -0,0 +1,94 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::MHANode::MHANode(const ngraph::Output<ngraph::Node> &q,
+                                const ngraph::Output<ngraph::Node> &k,
+                                const ngraph::Output<ngraph::Node> &v,
+                                float scale,
+                                bool transpose_k)
+    : Op({q, k, v}), m_scale(scale), m_transpose_k(transpose_k) {
+    validate_and_infer_types();
+}
+
+ov::intel_cpu::MHANode::MHANode(const ngraph::Output<ngraph::Node> &q,
+                                const ngraph::Output<ngraph::Node> &k,
+                                const ngraph::Output<ngraph::Node> &v,
+                                const ngraph::Output<ngraph::Node> &mask,
+                                float scale,
+                                bool transpose_k)
+    : Op({q, k, v, mask}), m_scale(scale), m_transpose_k(transpose_k) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::MHANode::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    INTERNAL_OP_SCOPE(MHANode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<ov::intel_cpu::MHANode>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_transpose_k);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<ov::intel_cpu::MHANode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                        m_scale, m_transpose_k);
+    }
+    throw ngraph::ngraph_error("Incorrect number of new arguments");
+}
+
+void ov::intel_cpu::MHANode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(MHANode_validate_and_infer_types);
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this, input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ", input_size, ", expected: 3 or 4.");
+
+    const auto type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this, get_input_element_type(1) == type && get_input_element_type(2) == type,
+        "Q, K and V must have the same element type");
+
+    const auto& q_shape = get_input_partial_shape(0);
+    const auto& k_shape = get_input_partial_shape(1);
+    const auto& v_shape = get_input_partial_shape(2);
+    if (q_shape.rank().is_dynamic() || k_shape.rank().is_dynamic() || v_shape.rank().is_dynamic()) {
+        set_output_type(0, type, ngraph::PartialShape::dynamic());
+        return;
+    }
+
+    const auto rank = q_shape.rank().get_length();
+    NODE_VALIDATION_CHECK(this, rank >= 2 && k_shape.rank().get_length() == rank && v_shape.rank().get_length() == rank,
+        "Q, K and V must have the same rank not less than 2");
+
+    auto output_shape = q_shape;
+    for (int64_t i = 0; i < rank - 2; i++) {
+        NODE_VALIDATION_CHECK(this, ngraph::Dimension::merge(output_shape[i], output_shape[i], k_shape[i]) &&
+                                    ngraph::Dimension::merge(output_shape[i], output_shape[i], v_shape[i]),
+            "Q, K and V must have the same batch dimensions");
+    }
+    const auto& k_length = m_transpose_k ? k_shape[rank - 2] : k_shape[rank - 1];
+    const auto& k_size = m_transpose_k ? k_shape[rank - 1] : k_shape[rank - 2];
+    NODE_VALIDATION_CHECK(this, q_shape[rank - 1].compatible(k_size) && k_length.compatible(v_shape[rank - 2]),
+        "Q, K and V have incompatible matrix dimensions");
+    output_shape[rank - 1] = v_shape[rank - 1];
+
+    if (input_size == 4) {
+        const auto& mask_shape = get_input_partial_shape(3);
+        NODE_VALIDATION_CHECK(this, mask_shape.rank().is_dynamic() || mask_shape.rank().get_length() <= rank,
+            "Mask rank must not be greater than the rank of Q");
+        auto scores_shape = output_shape;
+        scores_shape[rank - 1] = k_length;
+        auto broadcasted_shape = scores_shape;
+        NODE_VALIDATION_CHECK(this,
+            ngraph::PartialShape::broadcast_merge_into(broadcasted_shape, mask_shape, ngraph::op::AutoBroadcastType::NUMPY) &&
+            broadcasted_shape.compatible(scores_shape),
+            "Mask must be broadcastable to the shape of scores");
+    }
+
+    set_output_type(0, type, output_shape);
+}
+
+bool ov::intel_cpu::MHANode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(MHANode_visit_attributes);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    return true;
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Scaled dot product attention: Softmax(Q * K^T * scale + mask) * V
+ * Inputs are Q [..., Lq, S], K [..., Lk, S] ([..., S, Lk] if transpose_k is false), V [..., Lk, Sv]
+ * and the optional mask broadcastable to [..., Lq, Lk], the output is [..., Lq, Sv].
+ */
+class MHANode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("MHA", "cpu_plugin_opset");
+
+    MHANode() = default;
+
+    MHANode(const ngraph::Output<ngraph::Node> &q, const ngraph::Output<ngraph::Node> &k, const ngraph::Output<ngraph::Node> &v,
+            float scale, bool transpose_k);
+
+    MHANode(const ngraph::Output<ngraph::Node> &q, const ngraph::Output<ngraph::Node> &k, const ngraph::Output<ngraph::Node> &v,
+            const ngraph::Output<ngraph::Node> &mask, float scale, bool transpose_k);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_k = true;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -245,6 +245,14 @@ void Node::selectOptimalPrimitiveDescriptor() {
 }
 
 void Node::selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority, bool ignoreConstInputs) {
+    if (primitiveTuner && !isDynamicNode() && !descs.empty() && getSupportedPrimitiveDescriptors().size() > 1) {
+        const auto selectedPrimitive = primitiveTuner->selectPrimitiveDescriptor(*this);
+        if (selectedPrimitive >= 0) {
+            selectPrimitiveDescriptorByIndex(selectedPrimitive);
+            return;
+        }
+    }
+
     for (auto& type : priority) {
         int selectedPrimitive = -1;
         int equalsFormatCount = -1;
@@ -301,7 +309,8 @@ void Node::selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& pr
 }
 
 bool Node::canBeInPlace() const {
-    // TODO [DS]: enable inPlace for dynamic shapes
+    // the output shape of a generic node may diverge from the input one at runtime, so the dynamic in-place is
+    // supported by the nodes which keep the memory consistent themselves (Concat, Split, Reshape)
     if (isDynamicNode()) {
         return false;
     }
@@ -1028,6 +1037,47 @@ bool Node::isConfigDefined(const NodeConfig &config) const {
     return true;
 }
 
+dnnl::primitive_desc_base Node::createSupportedPrimitiveDesc(size_t index) {
+    auto descsCompatible = [](const std::vector<MemoryDescPtr>& srcDescs,
+                              const std::vector<PortConfig>& supportedDescs) {
+        if (srcDescs.empty() && supportedDescs.empty())
+            return true;
+        if (srcDescs.empty() || supportedDescs.empty())
+            return false;
+        for (size_t i = 0; i < srcDescs.size() && i < supportedDescs.size(); i++) {
+            if (!srcDescs[i]->isCompatible(*supportedDescs[i].getMemDesc()))
+                return false;
+        }
+        return true;
+    };
+
+    const auto& supported = getSupportedPrimitiveDescriptors()[index];
+    for (const auto& desc : descs) {
+        auto itpd = desc.createPrimitiveDescriptorIterator(engine);
+
+        while (static_cast<bool>(itpd)) {
+            std::vector<MemoryDescPtr> srcDescs;
+            for (size_t i = 0; i < descInputNumbers(desc); i++)
+                srcDescs.push_back(getSrcMemDesc(itpd, i));
+
+            std::vector<MemoryDescPtr> dstDescs;
+            for (size_t i = 0; i < descOutputNumbers(desc); i++)
+                dstDescs.push_back(getDstMemDesc(itpd, i));
+
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+
+            if (impl_type == supported.getImplementationType() &&
+                descsCompatible(srcDescs, supported.getConfig().inConfs) &&
+                descsCompatible(dstDescs, supported.getConfig().outConfs)) {
+                return dnnl::primitive_desc_base(itpd.get());
+            }
+            if (!itpd.next_impl())
+                break;
+        }
+    }
+    return {};
+}
+
 MemoryDescPtr Node::getSrcMemDesc(dnnl::primitive_desc_iterator &primitive_desc_it, size_t idx) {
     if (getInputShapeAtPort(idx).isDynamic()) {
         return DnnlExtensionUtils::makeUndefinedDesc(primitive_desc_it.src_desc(idx), getInputShapeAtPort(idx));
@@ -30,6 +30,7 @@
 #include "cpu_shape.h"
 #include "nodes/node_config.h"
 #include "cache/multi_cache.h"
+#include "primitive_tuner.h"
 
 #include <utils/shape_inference/static_shape.hpp>
 #include <utils/shape_inference/shape_inference.hpp>
@@ -325,11 +326,18 @@ public:
 
     std::string getPrimitiveDescriptorType();
 
+    /**
+     * @brief Creates oneDNN primitive descriptor of the supported primitive descriptor without fused operations
+     * @param index index of the supported primitive descriptor
+     * @return empty descriptor if the supported primitive descriptor is not created from the node descriptors
+     */
+    dnnl::primitive_desc_base createSupportedPrimitiveDesc(size_t index);
+
     PerfCount &PerfCounter() { return perfCounter; }
 
     virtual void setDynamicBatchLim(int lim);
 
-    void resolveInPlaceEdges();
+    virtual void resolveInPlaceEdges();
 
     virtual void execute(dnnl::stream strm);
     void executeDynamic(dnnl::stream strm);
@@ -573,6 +581,10 @@ public:
         rtParamsCache = cache;
     }
 
+    void setPrimitiveTuner(PrimitiveTunerPtr tuner) {
+        primitiveTuner = tuner;
+    }
+
 protected:
     bool canFuseSimpleOperation(const NodePtr& node) const;
 
@@ -769,6 +781,7 @@ private:
     PerfCounters profiling;
 
     MultiCachePtr rtParamsCache;
+    PrimitiveTunerPtr primitiveTuner;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
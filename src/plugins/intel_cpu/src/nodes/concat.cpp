@@ -88,11 +88,18 @@ void Concat::getSupportedDescriptors() {
     }
 
     // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat
-    // TODO [DS]: inplace
-    if (!isDynamicNode()) {
-        const auto& childDims = outputShapes[0].getStaticDims();
-        if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
-            canBeInPlace = true;
+    const auto& childDims = outputShapes[0].getDims();
+    if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
+        canBeInPlace = true;
+
+    // in the dynamic case the inputs occupy the parts of the output memory proportional to their sizes along the axis,
+    // so these sizes have to be known at compile time
+    if (isDynamicNode()) {
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            const auto axisDim = getInputShapeAtPort(i).getDims()[axis];
+            if (axisDim == Shape::UNDEFINED_DIM || axisDim == 0)
+                canBeInPlace = false;
+        }
     }
 }
 
@@ -161,7 +168,6 @@ void Concat::initSupportedPrimitiveDescriptors() {
             config.inConfs[i].inPlace(-1);
             config.inConfs[i].constant(false);
             auto desc = itr->second->createSharedDesc(inputPrecision, getInputShapeAtPort(i));
-            // TODO [DS]: inplace
             if (isDynamicNode()) {
                 config.inConfs[i].setMemDesc(desc);
             } else {
@@ -181,10 +187,22 @@ void Concat::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    // TODO [DS]: inplace
     if (!canBeInPlace || std::any_of(inputShapes.begin(), inputShapes.end(), [](const Shape& shape) { return shape.hasZeroDims(); }))
         return;
 
+    // Optimized inplace case for dynamic shapes: the inputs are dense and share the memory of the output via the partitioned
+    // memory managers, see resolveInPlaceEdges
+    if (isDynamicNode()) {
+        for (auto refPdIndex : pdIndexesToReuse) {
+            auto config = supportedPrimitiveDescriptors[refPdIndex].getConfig();
+            for (size_t i = 0; i < config.inConfs.size(); i++) {
+                config.inConfs[i].inPlace(0);
+            }
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        }
+        return;
+    }
+
     // Optimized inplace case
     for (auto refPdIndex : pdIndexesToReuse) {
         const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
@@ -347,6 +365,43 @@ bool Concat::isOptimized() const {
     return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].inPlace() >= 0;
 }
 
+void Concat::resolveInPlaceEdges() {
+    if (!isDynamicNode() || !isOptimized()) {
+        Node::resolveInPlaceEdges();
+        return;
+    }
+
+    // the output may be a part of the memory of an in-place consumer, e.g. of the next optimized concat,
+    // so the memory of the consumer is resolved first
+    auto childEdge = getChildEdgeAt(0);
+    if (childEdge->getStatus() == Edge::Status::NotAllocated)
+        childEdge->getChild()->resolveInPlaceEdges();
+
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+    auto baseMemMngr = childEdge->getMemory().getDnnlMemoryMngr();
+    size_t totalAxisDim = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        totalAxisDim += getInputShapeAtPort(i).getDims()[axis];
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto axisDim = getInputShapeAtPort(i).getDims()[axis];
+        auto memMngr = std::make_shared<PartitionedMemoryMngr>(baseMemMngr, totalAxisDim, offset, axisDim);
+        offset += axisDim;
+
+        // the other consumers of the parent port share the same part of the output memory
+        auto parentEdge = getParentEdgeAt(i);
+        for (auto& edge : parentEdge->getParent()->getChildEdgesAtPort(parentEdge->getInputNum())) {
+            if (edge->getStatus() != Edge::Status::NotAllocated)
+                continue;
+            edge->getMemoryPtr().reset(new Memory(getEngine()));
+            edge->getMemoryPtr()->Create(config.inConfs[i].getMemDesc(), memMngr);
+            edge->changeStatus(Edge::Status::Allocated);
+        }
+    }
+}
+
 bool Concat::needPrepareParams() const {
     if (canOptimizeNspc) {
         return false;
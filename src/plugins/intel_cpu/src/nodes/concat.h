@@ -33,6 +33,7 @@ public:
     bool isExecutable() const override;
     bool needPrepareParams() const override;
     void prepareParams() override;
+    void resolveInPlaceEdges() override;
 
 private:
     size_t axis = 0;
@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha_kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+namespace {
+
+// dst += a * src
+inline void axpy(float* dst, const float* src, float a, size_t n) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    const __m256 va = _mm256_set1_ps(a);
+    for (; i + 16 <= n; i += 16) {
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(src + i), _mm256_loadu_ps(dst + i)));
+        _mm256_storeu_ps(dst + i + 8, _mm256_fmadd_ps(va, _mm256_loadu_ps(src + i + 8), _mm256_loadu_ps(dst + i + 8)));
+    }
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(src + i), _mm256_loadu_ps(dst + i)));
+#endif
+    for (; i < n; i++)
+        dst[i] += a * src[i];
+}
+
+inline void scale(float* dst, float a, size_t n) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    const __m256 va = _mm256_set1_ps(a);
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(va, _mm256_loadu_ps(dst + i)));
+#endif
+    for (; i < n; i++)
+        dst[i] *= a;
+}
+
+inline float max(const float* src, size_t n) {
+    float result = -std::numeric_limits<float>::infinity();
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    if (n >= 8) {
+        __m256 vmax = _mm256_loadu_ps(src);
+        for (i = 8; i + 8 <= n; i += 8)
+            vmax = _mm256_max_ps(vmax, _mm256_loadu_ps(src + i));
+        __m128 vmax4 = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+        vmax4 = _mm_max_ps(vmax4, _mm_movehl_ps(vmax4, vmax4));
+        vmax4 = _mm_max_ss(vmax4, _mm_shuffle_ps(vmax4, vmax4, 1));
+        result = _mm_cvtss_f32(vmax4);
+    }
+#endif
+    for (; i < n; i++)
+        result = std::max(result, src[i]);
+    return result;
+}
+
+}  // namespace
+
+void mha_block(const float* q, const float* k, const float* v,
+               const float* mask, size_t maskRowStride, size_t maskColStride,
+               size_t m, size_t n, size_t S, size_t Sv,
+               float* scores, float* acc, float* rowMax, float* rowSum) {
+    for (size_t i = 0; i < m; i++) {
+        if (mask) {
+            const float* maskRow = mask + i * maskRowStride;
+            for (size_t j = 0; j < n; j++)
+                scores[j] = maskRow[j * maskColStride];
+        } else {
+            std::fill(scores, scores + n, 0.f);
+        }
+        // the scores of a row are accumulated along contiguous rows of the transposed K
+        for (size_t s = 0; s < S; s++)
+            axpy(scores, k + s * n, q[i * S + s], n);
+
+        const float newMax = std::max(rowMax[i], max(scores, n));
+        // all the scores of the row seen so far are masked out
+        if (newMax == -std::numeric_limits<float>::infinity())
+            continue;
+        // rescales the output accumulated with the previous maximum
+        const float correction = std::exp(rowMax[i] - newMax);
+        float* rowAcc = acc + i * Sv;
+        if (correction != 1.f)
+            scale(rowAcc, correction, Sv);
+        float sum = 0.f;
+        for (size_t j = 0; j < n; j++) {
+            scores[j] = std::exp(scores[j] - newMax);
+            sum += scores[j];
+        }
+        rowSum[i] = rowSum[i] * correction + sum;
+        rowMax[i] = newMax;
+        for (size_t j = 0; j < n; j++)
+            axpy(rowAcc, v + j * Sv, scores[j], Sv);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
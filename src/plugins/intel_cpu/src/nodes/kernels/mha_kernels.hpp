@@ -0,0 +1,32 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+/**
+ * Attends m rows of Q (already scaled) to a block of n keys and values, updating the online softmax state of the rows.
+ * @param q          [m, S] block of Q
+ * @param k          [S, n] transposed block of K
+ * @param v          [n, Sv] block of V
+ * @param mask       mask of the first row and the first key of the block or nullptr,
+ *                   its rows and columns are addressed with the given strides (0 for broadcasted dimensions)
+ * @param scores     scratch for n scores
+ * @param acc        [m, Sv] output accumulated with the running maximum of each row
+ * @param rowMax     running maximum of the scores of each row
+ * @param rowSum     running sum of the exponents of each row
+ */
+void mha_block(const float* q, const float* k, const float* v,
+               const float* mask, size_t maskRowStride, size_t maskColStride,
+               size_t m, size_t n, size_t S, size_t Sv,
+               float* scores, float* acc, float* rowMax, float* rowSum);
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
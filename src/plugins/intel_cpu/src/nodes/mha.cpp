@@ -0,0 +1,247 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "kernels/mha_kernels.hpp"
+#include "ngraph_transformations/op/mha.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+
+// a block of Q rows with a block of K rows and V rows fit into L2 cache for typical head sizes
+constexpr size_t qBlockSize = 32;
+constexpr size_t kBlockSize = 128;
+
+}   // namespace
+
+bool MHA::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto mha = std::dynamic_pointer_cast<const MHANode>(op);
+        if (!mha) {
+            errorMessage = "Only MHA operation from cpu_plugin_opset is supported";
+            return false;
+        }
+        if (op->get_input_partial_shape(Q_ID).rank().is_dynamic()) {
+            errorMessage = "Doesn't support Q with dynamic rank";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MHA::MHA(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng,
+        WeightsSharing::Ptr &cache) : Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "MHA node with name '" + op->get_friendly_name() + "'";
+    const auto mha = std::dynamic_pointer_cast<const MHANode>(op);
+
+    if ((inputShapes.size() != 3 && inputShapes.size() != 4) || outputShapes.size() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    scale = mha->get_scale();
+    transposeK = mha->get_transpose_k();
+    withMask = inputShapes.size() == 4;
+}
+
+void MHA::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto precision = getOriginalInputPrecisionAtPort(Q_ID);
+    if (precision != Precision::BF16 || !mayiuse(avx512_core))
+        precision = Precision::FP32;
+
+    std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, precision},
+                                             {LayoutType::ncsp, precision},
+                                             {LayoutType::ncsp, precision}};
+    // the mask is added to the scores accumulated in fp32
+    if (withMask)
+        inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+
+    // the kernels are cross compiled, the AVX2 build is dispatched in runtime
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, precision}}, mayiuse(avx2) ? impl_desc_type::gemm_avx2 : impl_desc_type::ref_any);
+}
+
+void MHA::prepareParams() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto& memPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!memPtr || !memPtr->isAllocated())
+            IE_THROW() << errorPrefix << " has not allocated input memory at port " << i;
+    }
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has not allocated output memory";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor";
+
+    const auto& qDims = getParentEdgeAt(Q_ID)->getMemory().getStaticDims();
+    const auto& kDims = getParentEdgeAt(K_ID)->getMemory().getStaticDims();
+    const auto& vDims = getParentEdgeAt(V_ID)->getMemory().getStaticDims();
+    const size_t rank = qDims.size();
+    if (kDims.size() != rank || vDims.size() != rank)
+        IE_THROW() << errorPrefix << " has Q, K and V with different ranks";
+    if (!std::equal(qDims.begin(), qDims.end() - 2, kDims.begin()) || !std::equal(qDims.begin(), qDims.end() - 2, vDims.begin()))
+        IE_THROW() << errorPrefix << " has Q, K and V with different batch dimensions";
+
+    batch = std::accumulate(qDims.begin(), qDims.end() - 2, size_t(1), std::multiplies<size_t>());
+    Lq = qDims[rank - 2];
+    S = qDims[rank - 1];
+    Lk = transposeK ? kDims[rank - 2] : kDims[rank - 1];
+    Sv = vDims[rank - 1];
+    if ((transposeK ? kDims[rank - 1] : kDims[rank - 2]) != S || vDims[rank - 2] != Lk)
+        IE_THROW() << errorPrefix << " has Q, K and V with incompatible matrix dimensions";
+
+    threadsNum = parallel_get_max_threads();
+    scratchPerThread = qBlockSize * S + S * kBlockSize + kBlockSize * Sv + kBlockSize + qBlockSize * Sv + 2 * qBlockSize;
+    scratch.resize(threadsNum * scratchPerThread);
+
+    if (!withMask)
+        return;
+
+    VectorDims scoresDims(qDims.begin(), qDims.end() - 1);
+    scoresDims.push_back(Lk);
+    auto maskDims = getParentEdgeAt(MASK_ID)->getMemory().getStaticDims();
+    if (maskDims.size() > rank)
+        IE_THROW() << errorPrefix << " has mask with rank greater than the rank of Q";
+    maskDims.insert(maskDims.begin(), rank - maskDims.size(), 1);
+
+    // broadcasted dimensions of the mask have zero strides
+    VectorDims maskStrides(rank, 0);
+    size_t stride = 1;
+    for (size_t i = rank; i-- > 0;) {
+        if (maskDims[i] != 1 && maskDims[i] != scoresDims[i])
+            IE_THROW() << errorPrefix << " has mask which cannot be broadcasted to the scores shape";
+        maskStrides[i] = maskDims[i] == 1 ? 0 : stride;
+        stride *= maskDims[i];
+    }
+    maskRowStride = maskStrides[rank - 2];
+    maskColStride = maskStrides[rank - 1];
+
+    maskBatchOffsets.resize(batch);
+    for (size_t b = 0; b < batch; b++) {
+        size_t rest = b;
+        size_t offset = 0;
+        for (size_t i = rank - 2; i-- > 0;) {
+            offset += (rest % scoresDims[i]) * maskStrides[i];
+            rest /= scoresDims[i];
+        }
+        maskBatchOffsets[b] = offset;
+    }
+}
+
+void MHA::executeDynamicImpl(dnnl::stream strm) {
+    execute(std::move(strm));
+}
+
+void MHA::execute(dnnl::stream strm) {
+    if (getParentEdgeAt(Q_ID)->getMemory().getDesc().getPrecision() == Precision::BF16) {
+        executeImpl<bfloat16_t>();
+    } else {
+        executeImpl<float>();
+    }
+}
+
+template <typename T>
+void MHA::executeImpl() {
+    const auto* q = reinterpret_cast<const T*>(getParentEdgeAt(Q_ID)->getMemoryPtr()->GetPtr());
+    const auto* k = reinterpret_cast<const T*>(getParentEdgeAt(K_ID)->getMemoryPtr()->GetPtr());
+    const auto* v = reinterpret_cast<const T*>(getParentEdgeAt(V_ID)->getMemoryPtr()->GetPtr());
+    const auto* mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t qBlocks = div_up(Lq, qBlockSize);
+    const size_t workAmount = batch * qBlocks;
+
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        float* qBlock = scratch.data() + ithr * scratchPerThread;
+        // the block of K is stored transposed, so the scores of a row are accumulated along contiguous memory
+        float* kBlock = qBlock + qBlockSize * S;
+        float* vBlock = kBlock + S * kBlockSize;
+        float* scores = vBlock + kBlockSize * Sv;
+        float* acc = scores + kBlockSize;
+        float* rowMax = acc + qBlockSize * Sv;
+        float* rowSum = rowMax + qBlockSize;
+
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t b = iwork / qBlocks;
+            const size_t q0 = (iwork % qBlocks) * qBlockSize;
+            const size_t m = std::min(qBlockSize, Lq - q0);
+            const T* qPtr = q + (b * Lq + q0) * S;
+            const T* kPtr = k + b * Lk * S;
+            const T* vPtr = v + b * Lk * Sv;
+
+            // the scale is applied to Q once instead of every score
+            for (size_t i = 0; i < m * S; i++)
+                qBlock[i] = static_cast<float>(qPtr[i]) * scale;
+            std::fill(acc, acc + m * Sv, 0.f);
+            std::fill(rowMax, rowMax + m, -std::numeric_limits<float>::infinity());
+            std::fill(rowSum, rowSum + m, 0.f);
+
+            for (size_t k0 = 0; k0 < Lk; k0 += kBlockSize) {
+                const size_t n = std::min(kBlockSize, Lk - k0);
+                if (transposeK) {
+                    for (size_t j = 0; j < n; j++)
+                        for (size_t s = 0; s < S; s++)
+                            kBlock[s * n + j] = static_cast<float>(kPtr[(k0 + j) * S + s]);
+                } else {
+                    for (size_t s = 0; s < S; s++)
+                        for (size_t j = 0; j < n; j++)
+                            kBlock[s * n + j] = static_cast<float>(kPtr[s * Lk + k0 + j]);
+                }
+                for (size_t i = 0; i < n * Sv; i++)
+                    vBlock[i] = static_cast<float>(vPtr[k0 * Sv + i]);
+
+                const float* maskBlock = withMask
+                        ? mask + maskBatchOffsets[b] + q0 * maskRowStride + k0 * maskColStride : nullptr;
+                XARCH::mha_block(qBlock, kBlock, vBlock, maskBlock, maskRowStride, maskColStride,
+                                 m, n, S, Sv, scores, acc, rowMax, rowSum);
+            }
+
+            T* dstPtr = dst + (b * Lq + q0) * Sv;
+            for (size_t i = 0; i < m; i++) {
+                const float norm = 1.f / rowSum[i];
+                for (size_t c = 0; c < Sv; c++)
+                    dstPtr[i * Sv + c] = static_cast<T>(acc[i * Sv + c] * norm);
+            }
+        }
+    });
+}
+
+bool MHA::created() const {
+    return getType() == Type::MHA;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
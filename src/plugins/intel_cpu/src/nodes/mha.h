@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * Scaled dot product attention fused by MHAFusion. Rows of Q are processed by blocks, the scores of a block
+ * against a block of K are softmaxed online (the running maximum and sum of every row rescale the accumulated
+ * output), so the whole [Lq, Lk] matrix of scores is never stored. The inner loops are cross compiled
+ * (kernels/mha_kernels.cpp) with AVX2 and for any CPU.
+ */
+class MHA : public Node {
+public:
+    MHA(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename T>
+    void executeImpl();
+
+    static constexpr size_t Q_ID = 0;
+    static constexpr size_t K_ID = 1;
+    static constexpr size_t V_ID = 2;
+    static constexpr size_t MASK_ID = 3;
+
+    float scale = 1.f;
+    bool transposeK = true;
+    bool withMask = false;
+
+    // product of batch dimensions
+    size_t batch = 0;
+    // lengths of query and key sequences, sizes of query/key and value vectors
+    size_t Lq = 0;
+    size_t Lk = 0;
+    size_t S = 0;
+    size_t Sv = 0;
+    // offsets of the mask broadcasted to [batch, Lq, Lk]
+    std::vector<size_t> maskBatchOffsets;
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+
+    // blocks of Q, K and V converted to fp32, scores and accumulators of every thread, allocated once per shape
+    std::vector<float> scratch;
+    size_t scratchPerThread = 0;
+    int threadsNum = 1;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
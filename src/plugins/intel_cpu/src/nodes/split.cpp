@@ -169,8 +169,18 @@ void Split::initSupportedPrimitiveDescriptors() {
     }
 
     // Optimized inplace case
-    // TODO [DS]: inplace
-    if (!isDynamicNode()) {
+    if (isDynamicNode()) {
+        // the outputs are dense and share the memory of the input via the partitioned memory managers, see resolveInPlaceEdges
+        if (canBeInPlaceDynamic()) {
+            for (auto refPdIndex : pdIndexesToReuse) {
+                auto config = supportedPrimitiveDescriptors[refPdIndex].getConfig();
+                for (size_t i = 0; i < outputShapes.size(); i++) {
+                    config.outConfs[i].inPlace(0);
+                }
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+            }
+        }
+    } else {
         for (auto refPdIndex : pdIndexesToReuse) {
             const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
             auto config = refConfig;
@@ -237,6 +247,52 @@ void Split::initSupportedPrimitiveDescriptors() {
     }
 }
 
+bool Split::canBeInPlaceDynamic() const {
+    if (getParentEdgeAt(0)->getParent()->isConstant())
+        return false;
+
+    // the outputs occupy the parts of the input memory proportional to their sizes along the axis,
+    // so the dims before the axis have to be 1 and the sizes along the axis have to be known at compile time
+    const auto& srcDims = getInputShapeAtPort(0).getDims();
+    if (!std::all_of(srcDims.begin(), srcDims.begin() + axis, [](size_t dim) { return dim == 1; }))
+        return false;
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        const auto axisDim = outputShapes[i].getDims()[axis];
+        if (axisDim == Shape::UNDEFINED_DIM || axisDim == 0)
+            return false;
+    }
+    return true;
+}
+
+void Split::resolveInPlaceEdges() {
+    if (!isDynamicNode() || !isOptimized()) {
+        Node::resolveInPlaceEdges();
+        return;
+    }
+
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+    auto baseMemMngr = getParentEdgeAt(0)->getMemory().getDnnlMemoryMngr();
+    size_t totalAxisDim = 0;
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        totalAxisDim += outputShapes[i].getDims()[axis];
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        const auto axisDim = outputShapes[i].getDims()[axis];
+        auto memMngr = std::make_shared<PartitionedMemoryMngr>(baseMemMngr, totalAxisDim, offset, axisDim);
+        offset += axisDim;
+
+        for (auto& childEdge : getChildEdgesAtPort(i)) {
+            if (childEdge->getStatus() != Edge::Status::NotAllocated)
+                continue;
+            childEdge->getMemoryPtr().reset(new Memory(getEngine()));
+            childEdge->getMemoryPtr()->Create(config.outConfs[i].getMemDesc(), memMngr);
+            childEdge->changeStatus(Edge::Status::Allocated);
+        }
+    }
+}
+
 bool Split::needPrepareParams() const {
     if (isOptimized()) {
         return false;
@@ -33,6 +33,7 @@ public:
     void prepareParams() override;
     std::vector<VectorDims> shapeInfer() const override;
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
+    void resolveInPlaceEdges() override;
 
 private:
     struct SplitExecutor {
@@ -55,6 +56,7 @@ private:
             size_t countStrides;
     };
 
+    bool canBeInPlaceDynamic() const;
     void optimizedNspc2Ncsp(size_t MB);
     std::vector<uint8_t*> getRawDstMemPtrs() const;
 
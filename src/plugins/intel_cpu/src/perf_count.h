@@ -4,8 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <ratio>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -50,6 +56,70 @@ public:
     ~PerfHelper() { counter.finish_itr(); }
 };
 
+/**
+ * @brief Fixed size ring buffer of per node execution samples, collected for every N-th inference
+ * when ov::intel_cpu::perf_sampling_rate is set. Unlike PerfCount it is shared between all the graphs
+ * of a compiled model and can be read at any time without stopping inference.
+ */
+class PerfSamples {
+public:
+    struct Sample {
+        uint64_t inferId;
+        std::string nodeName;
+        std::string layerType;
+        std::string execType;
+        uint64_t realTimeNs;
+        size_t bytes;
+        // time from the start of the inference to the start of the node
+        uint64_t startNs;
+    };
+
+    explicit PerfSamples(size_t capacity = 4096) : samples(capacity) {}
+
+    uint64_t nextInferId() {
+        std::lock_guard<std::mutex> lock{mutex};
+        return inferCounter++;
+    }
+
+    void push(Sample sample) {
+        std::lock_guard<std::mutex> lock{mutex};
+        samples[head] = std::move(sample);
+        head = (head + 1) % samples.size();
+        size = std::min(size + 1, samples.size());
+    }
+
+    // one "infer_id,node,layer_type,exec_type,real_time_ns,bytes,start_ns" line per sample, oldest first,
+    // string fields are quoted as in RFC 4180
+    std::string dump() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        std::ostringstream out;
+        for (size_t i = 0; i < size; i++) {
+            const auto& sample = samples[(head + samples.size() - size + i) % samples.size()];
+            out << sample.inferId << ',' << quoted(sample.nodeName) << ',' << quoted(sample.layerType) << ','
+                << quoted(sample.execType) << ',' << sample.realTimeNs << ',' << sample.bytes << ',' << sample.startNs
+                << '\n';
+        }
+        return out.str();
+    }
+
+private:
+    static std::string quoted(const std::string& field) {
+        std::string result = "\"";
+        for (const auto c : field) {
+            if (c == '"')
+                result += '"';
+            result += c;
+        }
+        return result + '"';
+    }
+
+    mutable std::mutex mutex;
+    std::vector<Sample> samples;
+    size_t head = 0;
+    size_t size = 0;
+    uint64_t inferCounter = 0;
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
 
@@ -109,6 +109,9 @@
 #include <low_precision/multiply_to_group_convolution.hpp>
 #include <low_precision/network_helper.hpp>
 #include "openvino/runtime/core.hpp"
+#include "openvino/core/compilation_monitor.hpp"
+#include "openvino/pass/profiler.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <ie_algorithm.hpp>
@@ -119,6 +122,8 @@
 #include "nodes/normalize.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
+#include "ngraph_transformations/mha_fusion.hpp"
+#include "ngraph_transformations/depth_first_tiling.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
 #include "utils/denormals.hpp"
@@ -249,7 +254,8 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool _enableMHAFusion,
+                                               const bool isLegacyApi) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -578,6 +584,9 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     postLPTPassManager.register_pass<ngraph::pass::FakeQuantizeDecomposition>();
     postLPTPassManager.register_pass<ngraph::pass::UnrollTensorIterator>();
     postLPTPassManager.register_pass<ReshapePRelu>();
+    // the fused node outperforms oneDNN MatMul and Softmax only with the AVX2 build of its kernels
+    if (_enableMHAFusion && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2))
+        postLPTPassManager.register_pass<MHAFusion>();
 
     postLPTPassManager.get_pass_config()->set_callback<ngraph::pass::FakeQuantizeDecomposition>([](const_node_ptr &node) -> bool {
         std::string errMsg;
@@ -629,9 +638,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets,
+                           const bool _enableMHAFusion, const bool isLegacyApi) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, _enableMHAFusion, isLegacyApi);
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
@@ -771,8 +781,22 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& profileProp = config.find(ov::intel_cpu::profile_transformations.name());
+    const bool enableProfiling = profileProp != config.end() ? profileProp->second == PluginConfigParams::YES
+                                                             : engConfig.profileTransformations;
+    const auto& mhaFusionProp = config.find(ov::intel_cpu::mha_fusion.name());
+    const bool enableMHAFusion = (mhaFusionProp != config.end() && mhaFusionProp->second == PluginConfigParams::YES)
+            || (mhaFusionProp == config.end() && engConfig.mhaFusion);
+    // collects statistics of all transformations executed on this thread until the profiler is destroyed
+    std::unique_ptr<ov::pass::Profiler> profiler;
+    if (enableProfiling)
+        profiler.reset(new ov::pass::Profiler);
+
+    if (auto monitor = ov::CompilationMonitor::get_current())
+        monitor->report(ov::CompilationStage::TRANSFORMATIONS);
+
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI());
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, enableMHAFusion, isLegacyAPI());
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -788,6 +812,18 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     ConvertToCPUSpecificOpset(nGraphFunc);
 
+    const auto& tilingProp = config.find(ov::intel_cpu::depth_first_tiling.name());
+    const bool enableTiling = tilingProp != config.end() ? tilingProp->second == PluginConfigParams::YES
+                                                         : engConfig.depthFirstTiling;
+    if (enableTiling) {
+        ngraph::pass::Manager manager;
+        manager.register_pass<DepthFirstTiling>(dnnl::utils::get_cache_size(2 /*level*/, true /*per core */));
+        manager.run_passes(nGraphFunc);
+    }
+
+    const auto transformationsProfile = profiler ? profiler->to_json() : std::string{};
+    profiler.reset();
+
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
@@ -809,7 +845,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this(), transformationsProfile);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -957,6 +993,15 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::intel_cpu::shape_buckets.name()),
+                                                    RW_property(ov::intel_cpu::perf_sampling_rate.name()),
+                                                    RW_property(ov::intel_cpu::profile_transformations.name()),
+                                                    RW_property(ov::intel_cpu::memory_allocator.name()),
+                                                    RW_property(ov::intel_cpu::primitives_autotuning.name()),
+                                                    RW_property(ov::intel_cpu::depth_first_tiling.name()),
+                                                    RW_property(ov::intel_cpu::intra_request_streams.name()),
+                                                    RW_property(ov::intel_cpu::layout_assignment.name()),
+                                                    RW_property(ov::intel_cpu::mha_fusion.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -1024,7 +1069,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16
                 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)));
-        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI());
+        Transformation(clonedNetwork, enableLPT, enableSnippets, conf.mhaFusion, isLegacyAPI());
         auto ops = clonnedFunction->get_ordered_ops();
 
         //Mark removed nodes as supported
@@ -0,0 +1,270 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "primitive_tuner.h"
+
+#include "node.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "openvino/util/file_util.hpp"
+#include "utils/debug_capabilities.h"
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr int measurementsCount = 3;
+
+const char* getIsaName() {
+    using namespace dnnl::impl::cpu::x64;
+    if (mayiuse(avx512_core_amx))
+        return "avx512_core_amx";
+    if (mayiuse(avx512_core_vnni))
+        return "avx512_core_vnni";
+    if (mayiuse(avx512_core))
+        return "avx512_core";
+    if (mayiuse(avx2))
+        return "avx2";
+    if (mayiuse(sse41))
+        return "sse41";
+    return "any";
+}
+
+size_t hashModel(const std::shared_ptr<const ov::Model>& model) {
+    auto combine = [](size_t seed, const std::string& value) {
+        return seed ^ (std::hash<std::string>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+    size_t seed = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        seed = combine(seed, op->get_type_name());
+        seed = combine(seed, op->get_friendly_name());
+        for (const auto& output : op->outputs()) {
+            seed = combine(seed, output.get_element_type().get_type_name());
+            seed = combine(seed, output.get_partial_shape().to_string());
+        }
+    }
+    return seed;
+}
+
+// identifies the node by its name, input shapes and precisions, so a stored result is not applied to a node
+// of the same name which was reshaped or executed in another precision
+std::string getNodeKey(const Node& node) {
+    std::stringstream key;
+    key << node.getName();
+    for (size_t i = 0; i < node.getOriginalInputsNumber(); i++) {
+        key << (i == 0 ? ";" : ",") << node.getOriginalInputPrecisionAtPort(i).name() << "[";
+        for (const auto dim : node.getInputShapeAtPort(i).getDims())
+            key << dim << " ";
+        key << "]";
+    }
+    key << ";";
+    for (size_t i = 0; i < node.getOriginalOutputsNumber(); i++) {
+        key << node.getOriginalOutputPrecisionAtPort(i).name() << ",";
+    }
+    return key.str();
+}
+
+// identifies the primitive descriptor independently of its position in the list of supported descriptors
+std::string getSignature(const NodeDesc& desc) {
+    std::stringstream signature;
+    signature << impl_type_to_string(desc.getImplementationType());
+    auto append = [&](const std::vector<PortConfig>& confs) {
+        signature << ";";
+        for (const auto& conf : confs) {
+            signature << conf.getMemDesc()->getPrecision().name() << ":" << conf.getMemDesc()->serializeFormat() << ",";
+        }
+    };
+    append(desc.getConfig().inConfs);
+    append(desc.getConfig().outConfs);
+    return signature.str();
+}
+
+template <typename Execute>
+double measure(const dnnl::engine& engine, const Execute& execute) {
+    dnnl::stream stream(engine);
+    // the first execution creates kernels and brings the data into caches
+    execute(stream);
+    stream.wait();
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < measurementsCount; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        execute(stream);
+        stream.wait();
+        const auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+dnnl::memory createZeroMemory(const dnnl::memory::desc& desc, const dnnl::engine& engine) {
+    dnnl::memory memory(desc, engine);
+    std::memset(memory.get_data_handle(), 0, desc.get_size());
+    return memory;
+}
+
+double measurePrimitive(const dnnl::primitive_desc_base& pd, const dnnl::engine& engine) {
+    static const int args[] = {DNNL_ARG_SRC, DNNL_ARG_SRC_1, DNNL_ARG_SRC_2, DNNL_ARG_WEIGHTS,
+                               DNNL_ARG_BIAS, DNNL_ARG_DST, DNNL_ARG_SCRATCHPAD};
+    std::unordered_map<int, dnnl::memory> primArgs;
+    for (auto arg : args) {
+        const auto desc = pd.query_md(dnnl::query::exec_arg_md, arg);
+        if (desc.get_size() == 0)
+            continue;
+        primArgs[arg] = createZeroMemory(desc, engine);
+    }
+    dnnl::primitive prim(pd.get());
+    return measure(engine, [&](dnnl::stream& stream) {
+        prim.execute(stream, primArgs);
+    });
+}
+
+double measureReorder(const MemoryDescPtr& from, const MemoryDescPtr& to, const dnnl::engine& engine) {
+    auto src = createZeroMemory(MemoryDescUtils::convertToDnnlMemoryDesc(from)->getDnnlDesc(), engine);
+    auto dst = createZeroMemory(MemoryDescUtils::convertToDnnlMemoryDesc(to)->getDnnlDesc(), engine);
+    dnnl::reorder reorder(src, dst);
+    return measure(engine, [&](dnnl::stream& stream) {
+        reorder.execute(stream, src, dst);
+    });
+}
+
+// time of reorders of non constant inputs, constant inputs are reordered once on graph creation
+double measureInputReorders(Node& node, const NodeConfig& config, const dnnl::engine& engine) {
+    double time = 0;
+    for (size_t j = 0; j < config.inConfs.size(); j++) {
+        auto parentEdge = node.getParentEdgeAt(j);
+        auto parent = parentEdge->getParent();
+        if (parent->isConstant())
+            continue;
+        auto parentPd = parent->getSelectedPrimitiveDescriptor();
+        if (parentPd == nullptr || parentPd->getConfig().outConfs.empty())
+            continue;
+        int inNum = parentEdge->getInputNum();
+        if (inNum < 0 || inNum >= parentPd->getConfig().outConfs.size())
+            inNum = 0;
+        const auto& curDesc = config.inConfs[j].getMemDesc();
+        const auto& parentDesc = parentPd->getConfig().outConfs[inNum].getMemDesc();
+        if (!curDesc->isCompatible(*parentDesc))
+            time += measureReorder(parentDesc, curDesc, engine);
+    }
+    return time;
+}
+
+}   // namespace
+
+PrimitiveTuner::PrimitiveTuner(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model) {
+    if (cacheDir.empty())
+        return;
+    std::stringstream fileName;
+    fileName << "cpu_tuning_" << std::hex << hashModel(model) << "_" << getIsaName() << ".txt";
+    filePath = ov::util::path_join({cacheDir, fileName.str()});
+
+    std::ifstream file(filePath);
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto separator = line.rfind('\t');
+        if (separator == std::string::npos)
+            continue;
+        results[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+}
+
+int PrimitiveTuner::findResult(const std::string& key, const std::vector<NodeDesc>& supported) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto result = results.find(key);
+    if (result == results.end())
+        return -1;
+    for (size_t i = 0; i < supported.size(); i++) {
+        if (getSignature(supported[i]) == result->second)
+            return static_cast<int>(i);
+    }
+    // the node differs from the one the result was stored for, so it is measured again
+    return -1;
+}
+
+int PrimitiveTuner::selectPrimitiveDescriptor(Node& node) {
+    const auto& supported = node.getSupportedPrimitiveDescriptors();
+    const auto key = getNodeKey(node);
+    int selected = findResult(key, supported);
+    if (selected >= 0)
+        return selected;
+
+    // graphs of the streams are created concurrently, so the measurements are serialized: they do not disturb
+    // the timings of each other, and the graphs waiting for the lock take the result of the first measurement
+    std::lock_guard<std::mutex> measurementLock{measurementMutex};
+    selected = findResult(key, supported);
+    if (selected >= 0)
+        return selected;
+
+    dnnl::engine engine(dnnl::engine::kind::cpu, 0);
+    double bestTime = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < supported.size(); i++) {
+        const auto& config = supported[i].getConfig();
+        if (config.inConfs.size() > node.getParentEdges().size())
+            continue;
+        try {
+            auto pd = node.createSupportedPrimitiveDesc(i);
+            if (!pd)
+                continue;
+            const auto time = measurePrimitive(pd, engine) + measureInputReorders(node, config, engine);
+            DEBUG_LOG(node.getName(), " pd[", i, "] ", getSignature(supported[i]), " takes ", time, " ms");
+            if (time < bestTime) {
+                bestTime = time;
+                selected = static_cast<int>(i);
+            }
+        } catch (const std::exception& e) {
+            DEBUG_LOG(node.getName(), " pd[", i, "] cannot be measured: ", e.what());
+        }
+    }
+
+    if (selected >= 0) {
+        std::lock_guard<std::mutex> lock{mutex};
+        results[key] = getSignature(supported[selected]);
+        modified = true;
+    }
+    return selected;
+}
+
+void PrimitiveTuner::save() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (filePath.empty() || !modified)
+        return;
+    // the results are the optimization hint only, so failures to store them are ignored. The file is written
+    // aside and renamed, so other compilations of the model never read it partially written
+    std::stringstream tmpPath;
+    tmpPath << filePath << "." << std::hex << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+    {
+        std::ofstream file(tmpPath.str());
+        for (const auto& result : results) {
+            file << result.first << '\t' << result.second << '\n';
+        }
+        file.close();
+        if (!file) {
+            std::remove(tmpPath.str().c_str());
+            return;
+        }
+    }
+    // rename does not replace the existing file on Windows
+    if (std::rename(tmpPath.str().c_str(), filePath.c_str()) != 0) {
+        std::remove(filePath.c_str());
+        if (std::rename(tmpPath.str().c_str(), filePath.c_str()) != 0) {
+            std::remove(tmpPath.str().c_str());
+            return;
+        }
+    }
+    modified = false;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
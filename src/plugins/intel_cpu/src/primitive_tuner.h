@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/model.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+class Node;
+class NodeDesc;
+
+/**
+ * @brief Selects primitive descriptors of nodes by their execution time measured on the real shapes
+ * instead of the static priority list. The winners are stored in the cache directory in a file keyed by
+ * the model and the highest ISA of the host, so later compilations of the same model reuse them.
+ * Graphs of all streams share the tuner. The measurements are serialized, so a node with the same key is measured
+ * by the first graph only and the graphs of other streams reuse the result.
+ */
+class PrimitiveTuner {
+public:
+    /**
+     * @param cacheDir directory of stored results, results are not stored if it is empty
+     * @param model model the graphs are created from
+     */
+    PrimitiveTuner(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model);
+
+    /**
+     * @brief Returns index of the fastest supported primitive descriptor of the node including reorders of its non
+     * constant inputs from the layouts selected by parents, -1 if none of the descriptors can be measured
+     */
+    int selectPrimitiveDescriptor(Node& node);
+
+    /**
+     * @brief Writes the results to the cache directory if new nodes were measured since the last call.
+     * The file is replaced atomically.
+     */
+    void save();
+
+private:
+    // index of the stored descriptor of the node with the key, -1 if there is no result or it does not match
+    int findResult(const std::string& key, const std::vector<NodeDesc>& supported);
+
+    std::string filePath;
+    // guards the results
+    std::mutex mutex;
+    // serializes the measurements
+    std::mutex measurementMutex;
+    // node name, input shapes and precisions -> signature of the selected primitive descriptor
+    std::unordered_map<std::string, std::string> results;
+    bool modified = false;
+};
+
+using PrimitiveTunerPtr = std::shared_ptr<PrimitiveTuner>;
+
+}   // namespace intel_cpu
+}   // namespace ov
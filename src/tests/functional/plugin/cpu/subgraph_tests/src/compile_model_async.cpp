@@ -0,0 +1,75 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <mutex>
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/exception.hpp"
+#include "ie_common.h"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+std::shared_ptr<ov::Model> create_model() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 3, 16, 16});
+    auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                         op::PadType::EXPLICIT, 8);
+    auto relu = std::make_shared<opset8::Relu>(conv);
+    auto result = std::make_shared<opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+}
+
+}  // namespace
+
+TEST(CompileModelAsyncCPUTest, ReportsStages) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    std::mutex mutex;
+    std::vector<ov::CompilationStage> stages;
+    auto monitor = std::make_shared<ov::CompilationMonitor>([&](ov::CompilationStage stage) {
+        std::lock_guard<std::mutex> lock{mutex};
+        stages.push_back(stage);
+    });
+    auto compiled_model = core->compile_model_async(create_model(), "CPU", monitor).get();
+    compiled_model.create_infer_request().infer();
+
+    for (auto stage : {ov::CompilationStage::TRANSFORMATIONS,
+                       ov::CompilationStage::GRAPH_BUILD,
+                       ov::CompilationStage::WEIGHTS_REORDER}) {
+        ASSERT_NE(std::find(stages.begin(), stages.end(), stage), stages.end());
+    }
+    ASSERT_EQ(ov::CompilationStage::TRANSFORMATIONS, stages.front());
+}
+
+TEST(CompileModelAsyncCPUTest, CancelledCompilationThrows) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    // cancels the compilation as soon as the plugin starts to build the graph
+    std::shared_ptr<ov::CompilationMonitor> monitor;
+    monitor = std::make_shared<ov::CompilationMonitor>([&](ov::CompilationStage stage) {
+        if (stage == ov::CompilationStage::GRAPH_BUILD)
+            monitor->cancel();
+    });
+    auto future = core->compile_model_async(create_model(), "CPU", monitor);
+    ASSERT_THROW(future.get(), ov::Cancelled);
+}
+
+TEST(CompileModelAsyncCPUTest, FailedCompilationKeepsExceptionType) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    auto monitor = std::make_shared<ov::CompilationMonitor>();
+    auto future = core->compile_model_async(create_model(), "CPU", monitor, {{"CPU_UNSUPPORTED_PROPERTY", "YES"}});
+    ASSERT_THROW(future.get(), InferenceEngine::NotFound);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,77 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "exec_graph_info.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *  params[0]   params[1]
+ *      |           |
+ *    Relu        Relu
+ *       \        /
+ *        Concat (axis 1)
+ *           |
+ *         Relu
+ *           |
+ *     Split (axis 1)
+ *      /    |    \
+ *  result result result
+ *
+ *  The dims before the axis are 1 and the sizes along the axis are static, so Concat and Split
+ *  are executed in place while the spatial dim changes from inference to inference.
+ */
+
+class ConcatSplitDynamicInPlaceTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<InputShape> inputShapes = {
+            {{1, 8, -1}, {{1, 8, 5}, {1, 8, 16}, {1, 8, 3}, {1, 8, 16}}},
+            {{1, 4, -1}, {{1, 4, 5}, {1, 4, 16}, {1, 4, 3}, {1, 4, 16}}}
+        };
+        init_input_shapes(inputShapes);
+
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto relu0 = std::make_shared<ov::opset8::Relu>(params[0]);
+        auto relu1 = std::make_shared<ov::opset8::Relu>(params[1]);
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{relu0, relu1}, 1);
+        auto relu = std::make_shared<ov::opset8::Relu>(concat);
+        auto split = ngraph::builder::makeSplit(relu, ov::element::f32, 3, 1);
+
+        ov::ResultVector results;
+        for (const auto& output : split->outputs()) {
+            results.push_back(std::make_shared<ov::opset8::Result>(output));
+        }
+        function = std::make_shared<ov::Model>(results, params, "ConcatSplitDynamicInPlace");
+    }
+
+    void checkInPlace(const std::string& nodeType) {
+        size_t count = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != nodeType)
+                continue;
+            count++;
+            const auto implType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(0, implType.find("unknown")) << nodeType << " is not in place, implementation " << implType;
+        }
+        ASSERT_EQ(1, count);
+    }
+};
+
+TEST_F(ConcatSplitDynamicInPlaceTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    checkInPlace("Concatenation");
+    checkInPlace("Split");
+}
+
+}  // namespace SubgraphTestsDefinitions
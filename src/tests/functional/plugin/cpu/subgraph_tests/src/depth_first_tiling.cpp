@@ -0,0 +1,76 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      param
+ *        |
+ *   Convolution 3x3
+ *        |
+ *      Relu
+ *        |
+ *   Convolution 3x3 (stride 2)
+ *        |
+ *      Relu
+ *        |
+ *   MaxPool 3x3 (stride 2)
+ *        |
+ *      result
+ *
+ *  The intermediate tensors do not fit into L2, so the chain is executed by bands of rows
+ *  concatenated at the end.
+ */
+
+class DepthFirstTilingCPUTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::depth_first_tiling(true));
+
+        const ov::Shape inputShape{1, 16, 224, 224};
+        init_input_shapes(static_shapes_to_test_representation({inputShape}));
+
+        auto params = ngraph::builder::makeParams(ov::element::f32, {inputShape});
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto relu1 = std::make_shared<ov::opset8::Relu>(conv1);
+        auto conv2 = ngraph::builder::makeConvolution(relu1, ov::element::f32, {3, 3}, {2, 2}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto relu2 = std::make_shared<ov::opset8::Relu>(conv2);
+        auto pool = ngraph::builder::makePooling(relu2, {2, 2}, {1, 1}, {1, 1}, {3, 3}, ov::op::RoundingType::FLOOR,
+                                                 ov::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(pool)}, params,
+                                               "DepthFirstTiling");
+    }
+};
+
+TEST_F(DepthFirstTilingCPUTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::depth_first_tiling));
+    CheckNumberOfNodesWithType(compiledModel, "Concatenation", 1);
+}
+
+TEST_F(DepthFirstTilingCPUTest, smoke_CompileConfigOverridesPluginConfig) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core ie;
+    ie.set_property(targetDevice, ov::intel_cpu::depth_first_tiling(true));
+    auto model = ie.compile_model(function, targetDevice, ov::intel_cpu::depth_first_tiling(false));
+    ASSERT_FALSE(model.get_property(ov::intel_cpu::depth_first_tiling));
+    CheckNumberOfNodesWithType(model, "Concatenation", 0);
+}
+
+}  // namespace SubgraphTestsDefinitions
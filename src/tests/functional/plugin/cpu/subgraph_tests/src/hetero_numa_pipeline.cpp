@@ -0,0 +1,79 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      param
+ *        |
+ *   Convolution 3x3
+ *        |
+ *      Relu
+ *        |
+ *   Convolution 3x3
+ *        |
+ *      Relu
+ *        |
+ *   Convolution 3x3
+ *        |
+ *      result
+ *
+ *  HETERO splits the network placed on CPU into pipeline stages bound to NUMA nodes.
+ */
+
+class HeteroNumaPipelineCPUTest : public SubgraphBaseTest, public testing::WithParamInterface<size_t> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<size_t>& obj) {
+        return "stages=" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = "HETERO:CPU";
+        configuration.insert({HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES), std::to_string(GetParam())});
+
+        const ov::Shape inputShape{1, 16, 32, 32};
+        init_input_shapes(static_shapes_to_test_representation({inputShape}));
+
+        auto params = ngraph::builder::makeParams(ov::element::f32, {inputShape});
+        ov::Output<ov::Node> output = params[0];
+        for (size_t i = 0; i < 3; i++) {
+            output = ngraph::builder::makeConvolution(output, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+            if (i < 2) {
+                output = std::make_shared<ov::opset8::Relu>(output);
+            }
+        }
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(output)}, params,
+                                               "HeteroNumaPipeline");
+    }
+};
+
+TEST_P(HeteroNumaPipelineCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    ASSERT_EQ(std::to_string(GetParam()),
+              compiledModel.get_property(HETERO_CONFIG_KEY(NUMA_PIPELINE_STAGES)).as<std::string>());
+
+    const auto statistics =
+        compiledModel.get_property(HETERO_METRIC_KEY(STAGES_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(3 * GetParam(), statistics.size());
+    for (size_t stage = 0; stage < GetParam(); stage++) {
+        ASSERT_GT(statistics.at("stage" + std::to_string(stage) + ".inferences"), 0);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_HeteroNumaPipeline, HeteroNumaPipelineCPUTest,
+                         ::testing::Values(1, 2, 3),
+                         HeteroNumaPipelineCPUTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,133 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                      param
+ *          /       /         \        \
+ *   Conv 1x1   Conv 3x3   Conv 5x5   MaxPool 3x3
+ *       |          |          |           |
+ *     Relu       Relu       Relu     Conv 1x1
+ *          \       \         /        /
+ *                 Concat (axis 1)
+ *                      |
+ *                    result
+ *
+ *  Branches of the inception block don't depend on each other, so their nodes are executed
+ *  concurrently by the core groups of the stream.
+ */
+
+namespace {
+
+std::shared_ptr<ov::Model> create_model(const ov::Shape& inputShape) {
+    auto params = ngraph::builder::makeParams(ov::element::f32, {inputShape});
+    auto makeBranch = [&](const ov::Output<ov::Node>& input, size_t kernel) -> ov::Output<ov::Node> {
+        const std::ptrdiff_t pad = kernel / 2;
+        auto conv = ngraph::builder::makeConvolution(input, ov::element::f32, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad},
+                                                     {1, 1}, ov::op::PadType::EXPLICIT, 8);
+        return std::make_shared<ov::opset8::Relu>(conv);
+    };
+    auto pool = ngraph::builder::makePooling(params[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ov::op::RoundingType::FLOOR,
+                                             ov::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+    auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{makeBranch(params[0], 1),
+                                                                        makeBranch(params[0], 3),
+                                                                        makeBranch(params[0], 5),
+                                                                        makeBranch(pool, 1)}, 1);
+
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(concat)}, params,
+                                       "IntraRequestStreams");
+}
+
+// [start, finish) of the nodes of every sampled inference, parsed from ov::intel_cpu::perf_samples
+std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> node_intervals(const std::string& samples) {
+    std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> intervals;
+    std::istringstream stream(samples);
+    std::string line;
+    while (std::getline(stream, line)) {
+        // the last fields are real_time_ns,bytes,start_ns
+        const auto startPos = line.rfind(',');
+        const auto bytesPos = line.rfind(',', startPos - 1);
+        const auto timePos = line.rfind(',', bytesPos - 1);
+        const auto start = std::stoull(line.substr(startPos + 1));
+        const auto time = std::stoull(line.substr(timePos + 1, bytesPos - timePos - 1));
+        intervals[line.substr(0, line.find(','))].emplace_back(start, start + time);
+    }
+    return intervals;
+}
+
+}  // namespace
+
+class IntraRequestStreamsCPUTest : public SubgraphBaseTest, public testing::WithParamInterface<uint32_t> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<uint32_t>& obj) {
+        return "intraRequestStreams=" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::intra_request_streams(GetParam()));
+
+        const ov::Shape inputShape{1, 16, 28, 28};
+        init_input_shapes(static_shapes_to_test_representation({inputShape}));
+
+        function = create_model(inputShape);
+    }
+};
+
+TEST_P(IntraRequestStreamsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    ASSERT_EQ(GetParam(), compiledModel.get_property(ov::intel_cpu::intra_request_streams));
+}
+
+TEST(IntraRequestStreamsExecutionCPUTest, BranchesAreExecutedConcurrently) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(create_model({1, 16, 56, 56}), "CPU", ov::num_streams(1),
+                                             ov::intel_cpu::intra_request_streams(4),
+                                             ov::intel_cpu::perf_sampling_rate(1));
+    ASSERT_EQ(4u, compiledModel.get_property(ov::intel_cpu::intra_request_streams));
+    auto request = compiledModel.create_infer_request();
+    for (size_t i = 0; i < 20; i++) {
+        request.infer();
+    }
+
+    // nodes executed one by one never overlap, so an overlap in any inference proves the groups ran concurrently
+    size_t concurrentInferences = 0;
+    for (auto& inference : node_intervals(compiledModel.get_property(ov::intel_cpu::perf_samples))) {
+        auto& intervals = inference.second;
+        std::sort(intervals.begin(), intervals.end());
+        for (size_t i = 1; i < intervals.size(); i++) {
+            if (intervals[i].first < intervals[i - 1].second) {
+                concurrentInferences++;
+                break;
+            }
+        }
+    }
+    ASSERT_GT(concurrentInferences, 0u);
+}
+
+TEST(IntraRequestStreamsExecutionCPUTest, ResetForSeveralStreams) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(create_model({1, 16, 28, 28}), "CPU", ov::num_streams(2),
+                                             ov::intel_cpu::intra_request_streams(4));
+    ASSERT_EQ(1u, compiledModel.get_property(ov::intel_cpu::intra_request_streams));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_IntraRequestStreams, IntraRequestStreamsCPUTest,
+                         ::testing::Values(1, 2, 4),
+                         IntraRequestStreamsCPUTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
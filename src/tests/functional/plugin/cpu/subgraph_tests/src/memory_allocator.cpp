@@ -0,0 +1,62 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+// intermediate buffers exceed the huge page size
+std::shared_ptr<ov::Model> create_model() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 4, 512, 512});
+    auto relu = std::make_shared<opset8::Relu>(param);
+    auto sigmoid = std::make_shared<opset8::Sigmoid>(relu);
+    auto result = std::make_shared<opset8::Result>(sigmoid);
+    return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+}
+
+std::vector<float> infer(ov::CompiledModel& compiled_model) {
+    auto request = compiled_model.create_infer_request();
+    auto input = request.get_input_tensor();
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++) {
+        data[i] = static_cast<float>(i % 17) - 8.f;
+    }
+    request.infer();
+    auto output = request.get_output_tensor();
+    return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+}
+
+}  // namespace
+
+TEST(MemoryAllocatorCPUTest, HugePagesGiveSameResults) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    auto reference_model = core->compile_model(create_model(), "CPU");
+    ASSERT_EQ(ov::intel_cpu::MemoryAllocator::DEFAULT, reference_model.get_property(ov::intel_cpu::memory_allocator));
+    const auto reference = infer(reference_model);
+
+    for (auto allocator : {ov::intel_cpu::MemoryAllocator::TRANSPARENT_HUGE_PAGES,
+                           ov::intel_cpu::MemoryAllocator::HUGE_PAGES}) {
+        auto compiled_model = core->compile_model(create_model(), "CPU", ov::intel_cpu::memory_allocator(allocator));
+        ASSERT_EQ(allocator, compiled_model.get_property(ov::intel_cpu::memory_allocator));
+        ASSERT_EQ(reference, infer(compiled_model));
+    }
+}
+
+TEST(MemoryAllocatorCPUTest, WrongValueThrows) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    ASSERT_ANY_THROW(core->compile_model(create_model(), "CPU", {{ov::intel_cpu::memory_allocator.name(), "MALLOC"}}));
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,151 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Q    K
+ *    \  /
+ *   MatMul
+ *     |
+ *  Multiply (scale)
+ *     |
+ *    Add (mask)         V
+ *     |                 |
+ *  Softmax             /
+ *      \              /
+ *       \            /
+ *          MatMul
+ *            |
+ *          Result
+ */
+
+enum class MaskType {
+    NONE,
+    PADDING,   // BERT-like mask of padded keys [B, 1, 1, L]
+    CAUSAL     // GPT-like constant mask of future tokens [1, 1, L, L]
+};
+
+using MHATestParams = std::tuple<std::vector<size_t>,     // Q shape [B, H, L, S]
+                                 MaskType,
+                                 bool,                    // transpose K in MatMul
+                                 Precision>;
+
+class MHATest : public testing::WithParamInterface<MHATestParams>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MHATestParams> obj) {
+        std::vector<size_t> shape;
+        MaskType maskType;
+        bool transposeK;
+        Precision precision;
+        std::tie(shape, maskType, transposeK, precision) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(shape) << "_";
+        result << "mask=" << (maskType == MaskType::NONE ? "none" : maskType == MaskType::PADDING ? "padding" : "causal") << "_";
+        result << "transposeK=" << transposeK << "_";
+        result << "precision=" << precision.name();
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<size_t> shape;
+        MaskType maskType;
+        bool transposeK;
+        Precision precision;
+        std::tie(shape, maskType, transposeK, precision) = this->GetParam();
+
+        configuration.insert({ov::intel_cpu::mha_fusion.name(), PluginConfigParams::YES});
+        if (precision == Precision::BF16) {
+            configuration.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
+            threshold = 0.05f;
+        } else {
+            configuration.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        }
+
+        const size_t L = shape[2];
+        const size_t S = shape[3];
+        auto kShape = shape;
+        if (!transposeK)
+            std::swap(kShape[2], kShape[3]);
+        std::vector<std::vector<size_t>> inputShapes = {shape, kShape, shape};
+        if (maskType == MaskType::PADDING)
+            inputShapes.push_back({shape[0], 1, 1, L});
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inputShapes);
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(params[0], params[1], false, transposeK);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, {}, {1.f / std::sqrt(static_cast<float>(S))});
+        std::shared_ptr<ngraph::Node> scores = std::make_shared<ngraph::opset1::Multiply>(qk, scale);
+        if (maskType == MaskType::PADDING) {
+            scores = std::make_shared<ngraph::opset1::Add>(scores, params[3]);
+        } else if (maskType == MaskType::CAUSAL) {
+            std::vector<float> mask(L * L, 0.f);
+            for (size_t i = 0; i < L; i++)
+                for (size_t j = i + 1; j < L; j++)
+                    mask[i * L + j] = -10000.f;
+            auto maskConst = ngraph::opset1::Constant::create(ngraph::element::f32, {1, 1, L, L}, mask);
+            scores = std::make_shared<ngraph::opset1::Add>(scores, maskConst);
+        }
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, 3);
+        auto mha = std::make_shared<ngraph::opset1::MatMul>(softmax, params[2]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(mha)};
+        function = std::make_shared<ngraph::Function>(results, params, "MHA");
+    }
+};
+
+TEST_P(MHATest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!with_cpu_x86_avx2())
+        GTEST_SKIP() << "MHA fusion requires AVX2";
+
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "MHA", 1);
+    CheckNumberOfNodesWithType(executableNetwork, "Softmax", 0);
+}
+
+TEST_P(MHATest, NotFusedByDefault) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.erase(ov::intel_cpu::mha_fusion.name());
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "MHA", 0);
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> shapes = {
+    {1, 2, 7, 5},       // sequences shorter than blocks
+    {2, 3, 45, 16},     // tails of query blocks
+    {1, 12, 128, 64},   // BERT-base
+    {1, 4, 300, 32},    // tails of key blocks
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_CPU, MHATest,
+                         ::testing::Combine(::testing::ValuesIn(shapes),
+                                            ::testing::Values(MaskType::NONE, MaskType::PADDING, MaskType::CAUSAL),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(Precision::FP32)),
+                         MHATest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_BF16_CPU, MHATest,
+                         ::testing::Combine(::testing::Values(std::vector<size_t>{1, 12, 128, 64}),
+                                            ::testing::Values(MaskType::PADDING),
+                                            ::testing::Values(true),
+                                            ::testing::Values(Precision::BF16)),
+                         MHATest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
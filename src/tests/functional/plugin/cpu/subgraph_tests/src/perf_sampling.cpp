@@ -0,0 +1,58 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+std::shared_ptr<ov::Model> create_relu_model() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 3, 8, 8});
+    auto relu = std::make_shared<opset8::Relu>(param);
+    // the name needs quoting in CSV
+    relu->set_friendly_name("relu, \"1\"");
+    auto result = std::make_shared<opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+}
+
+std::set<std::string> sampled_infer_ids(const std::string& samples) {
+    std::set<std::string> ids;
+    std::istringstream stream(samples);
+    std::string line;
+    while (std::getline(stream, line)) {
+        ids.insert(line.substr(0, line.find(',')));
+    }
+    return ids;
+}
+
+}  // namespace
+
+TEST(PerfSamplingCPUTest, SamplesAreCollectedEveryNthInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_relu_model(), "CPU", ov::num_streams(1));
+    ASSERT_EQ(0, compiled_model.get_property(ov::intel_cpu::perf_sampling_rate));
+
+    auto req = compiled_model.create_infer_request();
+    req.infer();
+    ASSERT_TRUE(compiled_model.get_property(ov::intel_cpu::perf_samples).empty());
+
+    compiled_model.set_property(ov::intel_cpu::perf_sampling_rate(2));
+    ASSERT_EQ(2, compiled_model.get_property(ov::intel_cpu::perf_sampling_rate));
+    for (size_t i = 0; i < 4; i++) {
+        req.infer();
+    }
+
+    const auto samples = compiled_model.get_property(ov::intel_cpu::perf_samples);
+    ASSERT_NE(std::string::npos, samples.find(",\"relu, \"\"1\"\"\",\"Relu\","));
+    ASSERT_EQ(2, sampled_infer_ids(samples).size());
+}
+
+}  // namespace SubgraphTestsDefinitions
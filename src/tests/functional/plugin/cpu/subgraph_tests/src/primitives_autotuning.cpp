@@ -0,0 +1,95 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+// depthwise and 1x1 convolutions with small channels have several competing implementations
+std::shared_ptr<ov::Model> create_model() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 8, 28, 28});
+    auto depthwise = builder::makeGroupConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                   op::PadType::EXPLICIT, 8, 8);
+    auto pointwise = builder::makeConvolution(depthwise, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 4);
+    auto result = std::make_shared<opset8::Result>(pointwise);
+    return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+}
+
+std::vector<float> infer(ov::CompiledModel& compiled_model) {
+    auto request = compiled_model.create_infer_request();
+    auto input = request.get_input_tensor();
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++) {
+        data[i] = static_cast<float>(i % 13) - 6.f;
+    }
+    request.infer();
+    auto output = request.get_output_tensor();
+    return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+}
+
+}  // namespace
+
+TEST(PrimitivesAutotuningCPUTest, TunedModelGivesSameResults) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    const auto model = create_model();
+    auto reference_model = core->compile_model(model, "CPU");
+    ASSERT_FALSE(reference_model.get_property(ov::intel_cpu::primitives_autotuning));
+    const auto reference = infer(reference_model);
+
+    auto tuned_model = core->compile_model(model, "CPU", ov::intel_cpu::primitives_autotuning(true));
+    ASSERT_TRUE(tuned_model.get_property(ov::intel_cpu::primitives_autotuning));
+    const auto tuned = infer(tuned_model);
+
+    ASSERT_EQ(reference.size(), tuned.size());
+    for (size_t i = 0; i < reference.size(); i++) {
+        ASSERT_NEAR(reference[i], tuned[i], 1e-4f);
+    }
+}
+
+TEST(PrimitivesAutotuningCPUTest, StreamsShareStoredResults) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+    const std::string cache_dir = "primitives_autotuning_streams_cache";
+    CommonTestUtils::removeFilesWithExt(cache_dir, "txt");
+    CommonTestUtils::createDirectory(cache_dir);
+
+    const auto model = create_model();
+    auto reference_model = core->compile_model(model, "CPU");
+    const auto reference = infer(reference_model);
+
+    // the graphs of the streams are created concurrently and measure the nodes under the same keys
+    auto tuned_model = core->compile_model(model, "CPU", ov::intel_cpu::primitives_autotuning(true), ov::num_streams(4),
+                                           ov::cache_dir(cache_dir));
+    const auto tuned = infer(tuned_model);
+    ASSERT_EQ(CommonTestUtils::listFilesWithExt(cache_dir, "txt").size(), 1u);
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(cache_dir, "tmp").empty());
+
+    ASSERT_EQ(reference.size(), tuned.size());
+    for (size_t i = 0; i < reference.size(); i++) {
+        ASSERT_NEAR(reference[i], tuned[i], 1e-4f);
+    }
+    CommonTestUtils::removeFilesWithExt(cache_dir, "txt");
+    CommonTestUtils::removeFilesWithExt(cache_dir, "blob");
+    CommonTestUtils::removeDir(cache_dir);
+}
+
+TEST(PrimitivesAutotuningCPUTest, WrongValueThrows) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    ASSERT_ANY_THROW(core->compile_model(create_model(), "CPU", {{ov::intel_cpu::primitives_autotuning.name(), "MAYBE"}}));
+}
+
+}  // namespace SubgraphTestsDefinitions
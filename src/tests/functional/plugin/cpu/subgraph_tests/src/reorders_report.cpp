@@ -0,0 +1,112 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+
+#include <regex>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+size_t get_value(const std::string& report, const std::string& key) {
+    std::smatch match;
+    const std::regex pattern("\"" + key + "\":([0-9]+)");
+    EXPECT_TRUE(std::regex_search(report, match, pattern)) << key << " is not found in " << report;
+    return match.empty() ? 0 : std::stoul(match[1].str());
+}
+
+std::string get_exec_value(const std::shared_ptr<ov::Node>& node, const std::string& key) {
+    return node->get_rt_info().at(key).as<std::string>();
+}
+
+size_t count_reorders(const std::shared_ptr<const ov::Model>& runtime_model) {
+    size_t reorders = 0;
+    for (const auto& node : runtime_model->get_ops()) {
+        if (get_exec_value(node, ExecGraphInfoSerialization::LAYER_TYPE) == "Reorder")
+            reorders++;
+    }
+    return reorders;
+}
+
+std::string get_output_layout(const std::shared_ptr<const ov::Model>& runtime_model, const std::string& name) {
+    for (const auto& node : runtime_model->get_ops()) {
+        if (node->get_friendly_name() == name)
+            return get_exec_value(node, ExecGraphInfoSerialization::OUTPUT_LAYOUTS);
+    }
+    ADD_FAILURE() << name << " is not found in the runtime model";
+    return {};
+}
+
+}  // namespace
+
+// convolutions prefer blocked layouts while the eltwise in between can be executed in any of them
+TEST(ReordersReportCPUTest, OptimizedLayoutsDoNotAddReorders) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 16, 20, 20});
+    auto conv1 = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                          op::PadType::EXPLICIT, 16);
+    auto relu = std::make_shared<opset8::Relu>(conv1);
+    auto conv2 = builder::makeConvolution(relu, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                          op::PadType::EXPLICIT, 16);
+    auto result = std::make_shared<opset8::Result>(conv2);
+    auto model = std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+
+    auto compiled_model = core->compile_model(model, "CPU", ov::intel_cpu::layout_assignment(true));
+    ASSERT_TRUE(compiled_model.get_property(ov::intel_cpu::layout_assignment));
+    const auto report = compiled_model.get_property(ov::intel_cpu::reorders_report);
+    ASSERT_FALSE(report.empty());
+
+    ASSERT_LE(get_value(report, "optimized_reorders"), get_value(report, "greedy_reorders"));
+    ASSERT_LE(get_value(report, "optimized_reorder_elements"), get_value(report, "greedy_reorder_elements"));
+    get_value(report, "inserted_reorders");
+}
+
+// both convolutions prefer the same blocked layout, the eltwise in front of them follows the planar input
+// if its descriptor is selected node by node, so its output is reordered on both edges to the convolutions
+TEST(ReordersReportCPUTest, LayoutAssignmentRemovesReorder) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    if (!InferenceEngine::with_cpu_x86_sse42())
+        GTEST_SKIP() << "Blocked layouts are not supported";
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 16, 20, 20});
+    auto relu = std::make_shared<opset8::Relu>(param);
+    relu->set_friendly_name("relu");
+    ResultVector results;
+    for (size_t i = 0; i < 2; i++) {
+        auto conv = builder::makeConvolution(relu, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        results.push_back(std::make_shared<opset8::Result>(conv));
+    }
+    auto model = std::make_shared<ov::Model>(results, ParameterVector{param});
+
+    auto greedy_model = core->compile_model(model, "CPU", ov::intel_cpu::layout_assignment(false));
+    ASSERT_FALSE(greedy_model.get_property(ov::intel_cpu::layout_assignment));
+    const auto greedy_runtime_model = greedy_model.get_runtime_model();
+    const auto greedy_layout = get_output_layout(greedy_runtime_model, "relu");
+
+    auto optimized_model = core->compile_model(model, "CPU", ov::intel_cpu::layout_assignment(true));
+    const auto report = optimized_model.get_property(ov::intel_cpu::reorders_report);
+    const auto optimized_runtime_model = optimized_model.get_runtime_model();
+    const auto optimized_layout = get_output_layout(optimized_runtime_model, "relu");
+
+    // a single reorder of the input replaces the reorders of the eltwise output to both convolutions
+    ASSERT_EQ("abcd", greedy_layout);
+    ASSERT_TRUE(optimized_layout == "aBcd8b" || optimized_layout == "aBcd16b" || optimized_layout == "acdb")
+        << optimized_layout;
+    ASSERT_LT(get_value(report, "optimized_reorders"), get_value(report, "greedy_reorders"));
+    ASSERT_LT(count_reorders(optimized_runtime_model), count_reorders(greedy_runtime_model));
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,68 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+std::shared_ptr<ov::Model> create_add_model() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{1, -1});
+    param->set_friendly_name("input_0");
+    auto constant = opset8::Constant::create(element::f32, {1}, {1.f});
+    auto add = std::make_shared<opset8::Add>(param, constant);
+    auto result = std::make_shared<opset8::Result>(add);
+    return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+}
+
+void infer_and_check(ov::InferRequest& req, const ov::Shape& shape) {
+    std::vector<float> data(ov::shape_size(shape));
+    std::iota(data.begin(), data.end(), 0.f);
+    req.set_input_tensor(ov::Tensor(element::f32, shape, data.data()));
+    req.infer();
+
+    const auto output = req.get_output_tensor();
+    ASSERT_EQ(shape, output.get_shape());
+    const auto out_data = output.data<float>();
+    for (size_t i = 0; i < data.size(); i++) {
+        ASSERT_EQ(data[i] + 1.f, out_data[i]);
+    }
+}
+
+}  // namespace
+
+TEST(ShapeBucketsCPUTest, InferBucketedAndDynamicShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_add_model(), "CPU",
+                                              ov::intel_cpu::shape_buckets("[1,16];[1,32]"));
+    ASSERT_EQ("[1,16];[1,32]", compiled_model.get_property(ov::intel_cpu::shape_buckets));
+
+    auto req = compiled_model.create_infer_request();
+    infer_and_check(req, {1, 16});
+    infer_and_check(req, {1, 32});
+    infer_and_check(req, {1, 16});
+    infer_and_check(req, {1, 20});
+
+    const auto statistics = compiled_model.get_property(ov::intel_cpu::shape_buckets_statistics);
+    ASSERT_EQ(3, statistics.size());
+    ASSERT_EQ(2, statistics.at("[1,16]"));
+    ASSERT_EQ(1, statistics.at("[1,32]"));
+    ASSERT_EQ(1, statistics.at("dynamic"));
+}
+
+TEST(ShapeBucketsCPUTest, IncompatibleBucketThrows) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+    ASSERT_ANY_THROW(core->compile_model(create_add_model(), "CPU", ov::intel_cpu::shape_buckets("[2,16]")));
+    ASSERT_ANY_THROW(core->compile_model(create_add_model(), "CPU", ov::intel_cpu::shape_buckets("[1,16],[1,16]")));
+}
+
+}  // namespace SubgraphTestsDefinitions
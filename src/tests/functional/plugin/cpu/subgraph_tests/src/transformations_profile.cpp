@@ -0,0 +1,50 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+std::shared_ptr<ov::Model> create_relu_model() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 16});
+    auto relu = std::make_shared<opset8::Relu>(param);
+    auto result = std::make_shared<opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+}
+
+}  // namespace
+
+TEST(TransformationsProfileCPUTest, ReportIsCollectedOnDemand) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto core = ov::test::utils::PluginCache::get().core();
+
+    auto compiled_model = core->compile_model(create_relu_model(), "CPU");
+    ASSERT_FALSE(compiled_model.get_property(ov::intel_cpu::profile_transformations));
+    ASSERT_TRUE(compiled_model.get_property(ov::intel_cpu::transformations_profile).empty());
+
+    compiled_model = core->compile_model(create_relu_model(), "CPU", ov::intel_cpu::profile_transformations(true));
+    ASSERT_TRUE(compiled_model.get_property(ov::intel_cpu::profile_transformations));
+    const auto profile = compiled_model.get_property(ov::intel_cpu::transformations_profile);
+    ASSERT_EQ(0, profile.find("{\"total_time_ms\":"));
+    ASSERT_NE(std::string::npos, profile.find("\"callbacks_attempted\":"));
+}
+
+TEST(TransformationsProfileCPUTest, CompileConfigOverridesPluginConfig) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ov::Core core;
+    core.set_property("CPU", ov::intel_cpu::profile_transformations(true));
+
+    auto compiled_model = core.compile_model(create_relu_model(), "CPU", ov::intel_cpu::profile_transformations(false));
+    ASSERT_FALSE(compiled_model.get_property(ov::intel_cpu::profile_transformations));
+    ASSERT_TRUE(compiled_model.get_property(ov::intel_cpu::transformations_profile).empty());
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,205 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include <common_test_utils/test_constants.hpp>
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/impl/mock_inference_plugin_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinference_plugin.hpp"
+#include <ie_core.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "plugin/mock_auto_device_plugin.hpp"
+#include "cpp/ie_plugin.hpp"
+#include "mock_common.hpp"
+#include <future>
+#include <mutex>
+
+using ::testing::_;
+using ::testing::StrEq;
+using ::testing::Return;
+using ::testing::Property;
+using ::testing::Eq;
+using ::testing::InvokeWithoutArgs;
+using ::testing::NiceMock;
+using Config = std::map<std::string, std::string>;
+using namespace MockMultiDevice;
+
+namespace {
+// one-shot event which can be set by any of the parties, waiting for it never depends on timing
+class Event {
+public:
+    Event() : _future(_promise.get_future().share()) {}
+    void Set() {
+        std::call_once(_flag, [this] { _promise.set_value(); });
+    }
+    bool Wait(std::chrono::milliseconds timeout = std::chrono::seconds(10)) const {
+        return _future.wait_for(timeout) == std::future_status::ready;
+    }
+    bool IsSet() const {
+        return Wait(std::chrono::milliseconds(0));
+    }
+
+private:
+    std::promise<void>       _promise;
+    std::shared_future<void> _future;
+    std::once_flag           _flag;
+};
+
+// sets the event on destruction, the executable network waits for the accelerator loading in its destructor
+struct EventSetter {
+    explicit EventSetter(Event& event) : _event(event) {}
+    ~EventSetter() {
+        _event.Set();
+    }
+    Event& _event;
+};
+}  // namespace
+
+class AutoCpuHelpHandoffTest : public ::testing::Test {
+public:
+    std::shared_ptr<ngraph::Function>                         function;
+    InferenceEngine::CNNNetwork                               cnnNet;
+    std::shared_ptr<NiceMock<MockICore>>                      core;
+    std::shared_ptr<NiceMock<MockMultiDeviceInferencePlugin>> plugin;
+
+    //mock exeNetwork of the mock accelerator
+    ov::SoPtr<IExecutableNetworkInternal>  mockExeNetworkActual;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> mockIExeNet;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> mockIExeNetActual;
+    // the only infer request of every device, completed by the test
+    ManualInferRequest                              cpuRequest;
+    ManualInferRequest                              actualRequest;
+    // the accelerator loading is blocked until the test opens it
+    Event                                           actualLoadOpened;
+    // the helper network is released by AUTO
+    Event                                           helperReleased;
+    // config for Auto device
+    std::map<std::string, std::string>              config;
+    std::vector<DeviceInformation>                  metaDevices;
+
+public:
+    void TearDown() override {
+        actualLoadOpened.Set();
+        core.reset();
+        plugin.reset();
+        mockExeNetworkActual = {};
+        mockIExeNet.reset();
+        mockIExeNetActual.reset();
+        config.clear();
+        metaDevices.clear();
+    }
+
+    void SetUp() override {
+       // prepare the mock helper and accelerator networks
+       mockIExeNet = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+
+       mockIExeNetActual = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+       mockExeNetworkActual = {mockIExeNetActual, {}};
+
+       // prepare mockicore and cnnNetwork for loading
+       core = std::make_shared<NiceMock<MockICore>>();
+       NiceMock<MockMultiDeviceInferencePlugin>* mock_multi = new NiceMock<MockMultiDeviceInferencePlugin>();
+       plugin.reset(mock_multi);
+       function = ngraph::builder::subgraph::makeConvPoolRelu();
+       cnnNet = InferenceEngine::CNNNetwork(function);
+       // replace core with mock Icore
+       plugin->SetCore(core);
+       // a single infer request per device, so the second request has to wait for an idle one
+       IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, optimalNum, 1);
+       ON_CALL(*mockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+           .WillByDefault(Return(optimalNum));
+       ON_CALL(*mockIExeNetActual.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+           .WillByDefault(Return(optimalNum));
+       ON_CALL(*mockIExeNet.get(), CreateInferRequest()).WillByDefault(Return(cpuRequest._request));
+       ON_CALL(*mockIExeNetActual.get(), CreateInferRequest()).WillByDefault(Return(actualRequest._request));
+       IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, supportConfigs, {});
+       ON_CALL(*core, GetMetric(_, StrEq(METRIC_KEY(SUPPORTED_CONFIG_KEYS)), _))
+           .WillByDefault(Return(supportConfigs));
+       ON_CALL(*core, GetConfig(_, StrEq(GPU_CONFIG_KEY(MAX_NUM_THREADS))))
+           .WillByDefault(Return(12));
+
+       // the helper network returned to AUTO owns a shared object which is destroyed once AUTO releases the helper
+       ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                   ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_CPU)),
+                   ::testing::Matcher<const Config&>(_))).WillByDefault(InvokeWithoutArgs([this]() {
+                       std::shared_ptr<void> so(nullptr, [this](void*) { helperReleased.Set(); });
+                       return ov::SoPtr<IExecutableNetworkInternal>{mockIExeNet, so}; }));
+       // the accelerator finishes the loading only when the test allows it, after the helper is ready
+       ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                   ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_GPU)),
+                   ::testing::Matcher<const Config&>(_))).WillByDefault(InvokeWithoutArgs([this]() {
+                       actualLoadOpened.Wait(std::chrono::hours(1));
+                       return mockExeNetworkActual; }));
+
+       metaDevices = {{CommonTestUtils::DEVICE_CPU, {}, -1}, {CommonTestUtils::DEVICE_GPU, {}, -1}};
+       ON_CALL(*plugin, ParseMetaDevices(_, _)).WillByDefault(Return(metaDevices));
+       ON_CALL(*plugin, SelectDevice(Property(&std::vector<DeviceInformation>::size, Eq(2)), _, _))
+               .WillByDefault(Return(metaDevices[1]));
+       ON_CALL(*plugin, SelectDevice(Property(&std::vector<DeviceInformation>::size, Eq(1)), _, _))
+               .WillByDefault(Return(metaDevices[0]));
+       config.insert({InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                     CommonTestUtils::DEVICE_CPU + std::string(",") + CommonTestUtils::DEVICE_GPU});
+       plugin->SetName("AUTO");
+    }
+};
+
+TEST_F(AutoCpuHelpHandoffTest, queuedRequestDoesNotWaitForHelper) {
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> exeNetwork;
+    // returns once the helper is loaded, the accelerator is still loading
+    ASSERT_NO_THROW(exeNetwork = plugin->LoadExeNetworkImpl(cnnNet, config));
+    EventSetter openActualLoad{actualLoadOpened};
+    {
+        auto busyRequest = exeNetwork->CreateInferRequest();
+        auto queuedRequest = exeNetwork->CreateInferRequest();
+        busyRequest->StartAsync();
+        ASSERT_TRUE(cpuRequest.WaitStarted(1));
+        // the only helper request is busy, so the second request is queued
+        queuedRequest->StartAsync();
+        actualLoadOpened.Set();
+        // the queued request is handed over once the accelerator is ready, the helper is still busy
+        ASSERT_TRUE(actualRequest.WaitStarted(1));
+        EXPECT_EQ(cpuRequest.Started(), 1);
+        actualRequest.Complete();
+        queuedRequest->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        cpuRequest.Complete();
+        busyRequest->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+    }
+    // no delay is configured, the helper is released once its request is done
+    EXPECT_TRUE(helperReleased.Wait());
+}
+
+TEST_F(AutoCpuHelpHandoffTest, helperTakesOverloadThenIsReleased) {
+    config.insert({ov::intel_auto::cpu_help_release_delay.name(), "300"});
+
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = plugin->LoadExeNetworkImpl(cnnNet, config));
+    EventSetter openActualLoad{actualLoadOpened};
+    EXPECT_EQ(exeNetwork->GetMetric(ov::intel_auto::cpu_help_release_delay.name()).as<uint32_t>(), 300u);
+    // the accelerator is loaded after the helper, GetContext waits for the accelerator to be ready
+    actualLoadOpened.Set();
+    exeNetwork->GetContext();
+    {
+        auto actualBusyRequest = exeNetwork->CreateInferRequest();
+        auto overloadRequest = exeNetwork->CreateInferRequest();
+        actualBusyRequest->StartAsync();
+        ASSERT_TRUE(actualRequest.WaitStarted(1));
+        // the accelerator has no idle request, so the helper serves the second one
+        overloadRequest->StartAsync();
+        ASSERT_TRUE(cpuRequest.WaitStarted(1));
+        EXPECT_EQ(actualRequest.Started(), 1);
+        EXPECT_FALSE(helperReleased.IsSet());
+        cpuRequest.Complete();
+        overloadRequest->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        actualRequest.Complete();
+        actualBusyRequest->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+    }
+    // no more overload, the helper is released after the delay
+    EXPECT_TRUE(helperReleased.Wait());
+    EXPECT_EQ(cpuRequest.Started(), 1);
+}
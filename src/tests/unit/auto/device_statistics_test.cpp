@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <sstream>
+#include "common.hpp"
+
+using namespace MockMultiDevicePlugin;
+
+TEST(DeviceStatisticsTest, firstSampleInitializesLatency) {
+    DeviceStatistics statistics;
+    EXPECT_EQ(statistics.Scheduled(), 1u);
+    EXPECT_EQ(statistics._inFlight.load(), 1u);
+    statistics.Completed(std::chrono::steady_clock::now() - std::chrono::milliseconds(8), 1);
+    EXPECT_EQ(statistics._inFlight.load(), 0u);
+    EXPECT_EQ(statistics._inferences.load(), 1u);
+    EXPECT_GE(statistics._latencyUs.load(), 8000u);
+    EXPECT_EQ(statistics._serviceUs.load(), statistics._latencyUs.load());
+}
+
+TEST(DeviceStatisticsTest, latencyIsMovingAverage) {
+    DeviceStatistics statistics;
+    statistics.Completed(std::chrono::steady_clock::now() - std::chrono::milliseconds(80), statistics.Scheduled());
+    const auto first = statistics._latencyUs.load();
+    statistics.Completed(std::chrono::steady_clock::now(), statistics.Scheduled());
+    // a single fast sample moves the average by 1/8 only
+    EXPECT_LT(statistics._latencyUs.load(), first);
+    EXPECT_GT(statistics._latencyUs.load(), first / 2);
+}
+
+TEST(DeviceStatisticsTest, serviceTimeIsLatencyPerRequestInFlight) {
+    DeviceStatistics statistics;
+    const auto scheduledTime = std::chrono::steady_clock::now() - std::chrono::milliseconds(80);
+    for (int i = 0; i < 3; i++) {
+        statistics.Scheduled();
+    }
+    // the request was scheduled with 3 others in flight
+    statistics.Completed(scheduledTime, statistics.Scheduled());
+    EXPECT_EQ(statistics._serviceUs.load(), statistics._latencyUs.load() / 4);
+}
+
+TEST(DeviceStatisticsTest, expectedCompletionGrowsWithRequestsInFlight) {
+    DeviceStatistics statistics;
+    statistics._inferences = 1;
+    statistics._serviceUs = 1000;
+    EXPECT_EQ(statistics.ExpectedCompletionUs(), 1000.0);
+    for (int i = 0; i < 3; i++) {
+        statistics.Scheduled();
+    }
+    EXPECT_EQ(statistics.ExpectedCompletionUs(), 4000.0);
+}
+
+TEST(DeviceStatisticsTest, unmeasuredDeviceIsProbedWithSingleRequest) {
+    DeviceStatistics statistics;
+    EXPECT_EQ(statistics.ExpectedCompletionUs(), 0.0);
+    statistics.Scheduled();
+    EXPECT_EQ(statistics.ExpectedCompletionUs(), std::numeric_limits<double>::max());
+}
+
+TEST(DeviceStatisticsTest, schedulePolicyPropertyRoundTrip) {
+    for (auto policy : {ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY, ov::intel_auto::SchedulePolicy::LATENCY_BALANCED}) {
+        std::stringstream strm;
+        strm << policy;
+        ov::intel_auto::SchedulePolicy parsed;
+        strm >> parsed;
+        EXPECT_EQ(parsed, policy);
+    }
+    std::stringstream strm{"ROUND_ROBIN"};
+    ov::intel_auto::SchedulePolicy parsed;
+    EXPECT_THROW(strm >> parsed, ov::Exception);
+}
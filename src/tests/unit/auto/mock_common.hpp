@@ -6,6 +6,10 @@
 #include <gmock/gmock.h>
 #include <ie_metric_helpers.hpp>
 #include <ie_core.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
 
 #define IE_SET_METRIC(key, name,  ...)                                                            \
     typename ::InferenceEngine::Metrics::MetricType<::InferenceEngine::Metrics::key>::type name = \
@@ -27,3 +31,46 @@ namespace internal {
     ON_CALL(*(HLogger), print(_)).WillByDefault([&](std::stringstream& stream) { \
             std::cout << stream.str() << std::endl; \
             });
+
+// the only infer request of a mock device, StartAsync records the start and the test completes the inference
+class ManualInferRequest {
+public:
+    ManualInferRequest() {
+        _request = std::make_shared<::testing::NiceMock<MockIInferRequestInternal>>();
+        ON_CALL(*_request, SetCallback(::testing::_))
+            .WillByDefault([this](std::function<void(std::exception_ptr)> callback) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _callback = std::move(callback);
+            });
+        ON_CALL(*_request, StartAsync()).WillByDefault([this]() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _started++;
+            _cv.notify_all();
+        });
+    }
+    // waits until the request is started the given number of times in total
+    bool WaitStarted(int times, std::chrono::milliseconds timeout = std::chrono::seconds(10)) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _cv.wait_for(lock, timeout, [&] { return _started >= times; });
+    }
+    int Started() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _started;
+    }
+    // completes the inference started last, the callback may start the next one
+    void Complete() {
+        std::function<void(std::exception_ptr)> callback;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            callback = _callback;
+        }
+        callback(nullptr);
+    }
+    std::shared_ptr<::testing::NiceMock<MockIInferRequestInternal>> _request;
+
+private:
+    std::mutex                                  _mutex;
+    std::condition_variable                     _cv;
+    std::function<void(std::exception_ptr)>     _callback;
+    int                                         _started = 0;
+};
@@ -0,0 +1,238 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include <common_test_utils/test_constants.hpp>
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/impl/mock_inference_plugin_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinference_plugin.hpp"
+#include <ie_core.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "plugin/mock_auto_device_plugin.hpp"
+#include "cpp/ie_plugin.hpp"
+#include "mock_common.hpp"
+#include "multi_schedule.hpp"
+
+using ::testing::_;
+using ::testing::StrEq;
+using ::testing::Return;
+using ::testing::NiceMock;
+using Config = std::map<std::string, std::string>;
+using namespace MockMultiDevice;
+
+using MultiSchedulePolicyParams = std::tuple<ov::intel_auto::SchedulePolicy,  // schedule policy
+                                             std::string>;                    // device of the second request
+
+class MultiSchedulePolicyTest : public ::testing::TestWithParam<MultiSchedulePolicyParams> {
+public:
+    std::shared_ptr<ngraph::Function>                         function;
+    InferenceEngine::CNNNetwork                               cnnNet;
+    std::shared_ptr<NiceMock<MockICore>>                      core;
+    std::shared_ptr<NiceMock<MockMultiDeviceInferencePlugin>> plugin;
+
+    ov::SoPtr<IExecutableNetworkInternal>                     cpuMockExeNetwork;
+    ov::SoPtr<IExecutableNetworkInternal>                     gpuMockExeNetwork;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> cpuMockIExeNet;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> gpuMockIExeNet;
+    // the infer requests of the devices in the order of creation, completed by the test
+    ManualInferRequest                                        cpuRequests[2];
+    ManualInferRequest                                        gpuRequest;
+    int                                                       cpuRequestsCreated = 0;
+    std::map<std::string, std::string>                        config;
+    std::vector<DeviceInformation>                            metaDevices;
+
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MultiSchedulePolicyParams> obj) {
+        ov::intel_auto::SchedulePolicy policy;
+        std::string expectedDevice;
+        std::tie(policy, expectedDevice) = obj.param;
+        std::ostringstream result;
+        result << "policy_" << policy << "_expect_" << expectedDevice;
+        return result.str();
+    }
+
+    void TearDown() override {
+        core.reset();
+        plugin.reset();
+        cpuMockExeNetwork = {};
+        gpuMockExeNetwork = {};
+        cpuMockIExeNet.reset();
+        gpuMockIExeNet.reset();
+        config.clear();
+        metaDevices.clear();
+    }
+
+    void SetUp() override {
+        cpuMockIExeNet = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        cpuMockExeNetwork = {cpuMockIExeNet, {}};
+        gpuMockIExeNet = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        gpuMockExeNetwork = {gpuMockIExeNet, {}};
+
+        core = std::make_shared<NiceMock<MockICore>>();
+        plugin.reset(new NiceMock<MockMultiDeviceInferencePlugin>());
+        function = ngraph::builder::subgraph::makeConvPoolRelu();
+        cnnNet = InferenceEngine::CNNNetwork(function);
+        plugin->SetCore(core);
+
+        // the CPU has two worker requests, the GPU has one
+        IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, cpuOptimalNum, 2);
+        IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, gpuOptimalNum, 1);
+        ON_CALL(*cpuMockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+            .WillByDefault(Return(cpuOptimalNum));
+        ON_CALL(*gpuMockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+            .WillByDefault(Return(gpuOptimalNum));
+        ON_CALL(*cpuMockIExeNet.get(), CreateInferRequest()).WillByDefault([this]() {
+            return cpuRequests[cpuRequestsCreated++ % 2]._request;
+        });
+        ON_CALL(*gpuMockIExeNet.get(), CreateInferRequest()).WillByDefault(Return(gpuRequest._request));
+        IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, supportConfigs, {});
+        ON_CALL(*core, GetMetric(_, StrEq(METRIC_KEY(SUPPORTED_CONFIG_KEYS)), _))
+            .WillByDefault(Return(supportConfigs));
+
+        ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                    ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_CPU)),
+                    ::testing::Matcher<const Config&>(_))).WillByDefault(Return(cpuMockExeNetwork));
+        ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                    ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_GPU)),
+                    ::testing::Matcher<const Config&>(_))).WillByDefault(Return(gpuMockExeNetwork));
+
+        // the CPU has the higher priority, so it is the first choice of DEVICE_PRIORITY
+        metaDevices = {{CommonTestUtils::DEVICE_CPU, {}, -1}, {CommonTestUtils::DEVICE_GPU, {}, -1}};
+        ON_CALL(*plugin, ParseMetaDevices(_, _)).WillByDefault(Return(metaDevices));
+        config.insert({InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                       CommonTestUtils::DEVICE_CPU + std::string(",") + CommonTestUtils::DEVICE_GPU});
+        plugin->SetName("MULTI");
+    }
+};
+
+TEST_P(MultiSchedulePolicyTest, requestIsDispatchedByPolicy) {
+    ov::intel_auto::SchedulePolicy policy;
+    std::string expectedDevice;
+    std::tie(policy, expectedDevice) = GetParam();
+    std::stringstream strm;
+    strm << policy;
+    config.insert({ov::intel_auto::schedule_policy.name(), strm.str()});
+
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = plugin->LoadExeNetworkImpl(cnnNet, config));
+    const auto supportedKeys = exeNetwork->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
+    EXPECT_NE(std::find(supportedKeys.begin(), supportedKeys.end(), ov::intel_auto::schedule_policy.name()),
+              supportedKeys.end());
+    EXPECT_EQ(exeNetwork->GetConfig(ov::intel_auto::schedule_policy.name()).as<std::string>(), strm.str());
+
+    auto firstRequest = exeNetwork->CreateInferRequest();
+    auto secondRequest = exeNetwork->CreateInferRequest();
+    // both devices are idle and not measured yet, so the first request goes to the CPU in both policies
+    firstRequest->StartAsync();
+    ASSERT_TRUE(cpuRequests[0].WaitStarted(1));
+    // the CPU has an idle request left, but LATENCY_BALANCED does not queue another request on a device
+    // before its first inference is measured
+    secondRequest->StartAsync();
+    if (expectedDevice == CommonTestUtils::DEVICE_CPU) {
+        ASSERT_TRUE(cpuRequests[1].WaitStarted(1));
+        EXPECT_EQ(gpuRequest.Started(), 0);
+        cpuRequests[1].Complete();
+    } else {
+        ASSERT_TRUE(gpuRequest.WaitStarted(1));
+        EXPECT_EQ(cpuRequests[1].Started(), 0);
+        gpuRequest.Complete();
+    }
+    secondRequest->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+    cpuRequests[0].Complete();
+    firstRequest->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+
+    const auto statistics =
+        exeNetwork->GetMetric(ov::intel_auto::device_statistics.name()).as<std::map<std::string, uint64_t>>();
+    EXPECT_EQ(statistics.at(CommonTestUtils::DEVICE_CPU + std::string(".inferences")),
+              expectedDevice == CommonTestUtils::DEVICE_CPU ? 2u : 1u);
+    EXPECT_EQ(statistics.at(CommonTestUtils::DEVICE_GPU + std::string(".inferences")),
+              expectedDevice == CommonTestUtils::DEVICE_GPU ? 1u : 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Multi_SchedulePolicy, MultiSchedulePolicyTest,
+                         ::testing::Values(
+                             MultiSchedulePolicyParams{ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY,
+                                                       CommonTestUtils::DEVICE_CPU},
+                             MultiSchedulePolicyParams{ov::intel_auto::SchedulePolicy::LATENCY_BALANCED,
+                                                       CommonTestUtils::DEVICE_GPU}),
+                         MultiSchedulePolicyTest::getTestCaseName);
+
+namespace {
+std::vector<std::string> SortedNames(DeviceMap<DeviceStatistics>& statistics) {
+    std::vector<DeviceInformation> devices = {{CommonTestUtils::DEVICE_CPU, {}, -1},
+                                              {CommonTestUtils::DEVICE_GPU, {}, -1},
+                                              {CommonTestUtils::DEVICE_MYRIAD, {}, -1}};
+    MultiSchedule::SortByExpectedCompletion(devices, statistics);
+    std::vector<std::string> names;
+    for (auto&& device : devices) {
+        names.push_back(device.deviceName);
+    }
+    return names;
+}
+
+void Measure(DeviceStatistics& statistics, uint64_t serviceUs, uint64_t inFlight) {
+    statistics._inferences = 1;
+    statistics._serviceUs = serviceUs;
+    statistics._inFlight = inFlight;
+}
+}  // namespace
+
+TEST(MultiScheduleSortTest, fasterDeviceGoesFirst) {
+    DeviceMap<DeviceStatistics> statistics;
+    Measure(statistics[CommonTestUtils::DEVICE_CPU], 4000, 0);
+    Measure(statistics[CommonTestUtils::DEVICE_GPU], 1000, 0);
+    Measure(statistics[CommonTestUtils::DEVICE_MYRIAD], 2000, 0);
+    EXPECT_EQ(SortedNames(statistics), std::vector<std::string>({CommonTestUtils::DEVICE_GPU,
+                                                                 CommonTestUtils::DEVICE_MYRIAD,
+                                                                 CommonTestUtils::DEVICE_CPU}));
+}
+
+TEST(MultiScheduleSortTest, queueDepthIsPartOfTheEstimate) {
+    DeviceMap<DeviceStatistics> statistics;
+    Measure(statistics[CommonTestUtils::DEVICE_CPU], 4000, 0);
+    // 1000us per request, but the new one waits for 4 in flight: 5000us
+    Measure(statistics[CommonTestUtils::DEVICE_GPU], 1000, 4);
+    Measure(statistics[CommonTestUtils::DEVICE_MYRIAD], 2000, 1);
+    EXPECT_EQ(SortedNames(statistics), std::vector<std::string>({CommonTestUtils::DEVICE_CPU,
+                                                                 CommonTestUtils::DEVICE_MYRIAD,
+                                                                 CommonTestUtils::DEVICE_GPU}));
+}
+
+TEST(MultiScheduleSortTest, unmeasuredDeviceIsProbedOnce) {
+    DeviceMap<DeviceStatistics> statistics;
+    Measure(statistics[CommonTestUtils::DEVICE_CPU], 1000, 0);
+    statistics[CommonTestUtils::DEVICE_GPU];
+    EXPECT_EQ(SortedNames(statistics).front(), CommonTestUtils::DEVICE_GPU);
+    // while the probe is in flight the device is tried after the measured ones
+    statistics[CommonTestUtils::DEVICE_GPU]._inFlight = 1;
+    EXPECT_EQ(SortedNames(statistics), std::vector<std::string>({CommonTestUtils::DEVICE_CPU,
+                                                                 CommonTestUtils::DEVICE_GPU,
+                                                                 CommonTestUtils::DEVICE_MYRIAD}));
+}
+
+TEST(MultiScheduleSortTest, tiesKeepPriorityOrder) {
+    DeviceMap<DeviceStatistics> statistics;
+    Measure(statistics[CommonTestUtils::DEVICE_CPU], 1000, 1);
+    Measure(statistics[CommonTestUtils::DEVICE_GPU], 2000, 0);
+    Measure(statistics[CommonTestUtils::DEVICE_MYRIAD], 1000, 1);
+    EXPECT_EQ(SortedNames(statistics), std::vector<std::string>({CommonTestUtils::DEVICE_CPU,
+                                                                 CommonTestUtils::DEVICE_GPU,
+                                                                 CommonTestUtils::DEVICE_MYRIAD}));
+}
+
+TEST(MultiScheduleSortTest, deviceWithoutStatisticsGoesLast) {
+    DeviceMap<DeviceStatistics> statistics;
+    Measure(statistics[CommonTestUtils::DEVICE_GPU], 1000, 0);
+    Measure(statistics[CommonTestUtils::DEVICE_MYRIAD], 2000, 0);
+    std::vector<std::string> names;
+    ASSERT_NO_THROW(names = SortedNames(statistics));
+    EXPECT_EQ(names, std::vector<std::string>({CommonTestUtils::DEVICE_GPU,
+                                               CommonTestUtils::DEVICE_MYRIAD,
+                                               CommonTestUtils::DEVICE_CPU}));
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/depth_first_tiling.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::shared_ptr<ngraph::Node> makeWeights() {
+    return ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 4, 3, 3}, {0.1f});
+}
+
+std::shared_ptr<ngraph::Node> makeConvolution(const ngraph::Output<ngraph::Node>& input, const ngraph::Output<ngraph::Node>& weights,
+                                              const ngraph::CoordinateDiff& padsBegin, const ngraph::CoordinateDiff& padsEnd) {
+    return std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1}, padsBegin, padsEnd,
+                                                         ngraph::Strides{1, 1}, ngraph::op::PadType::EXPLICIT);
+}
+
+std::shared_ptr<ngraph::Node> makeMaxPool(const ngraph::Output<ngraph::Node>& input) {
+    return std::make_shared<ngraph::opset1::MaxPool>(input, ngraph::Strides{2, 2}, ngraph::Shape{0, 0}, ngraph::Shape{0, 0},
+                                                     ngraph::Shape{2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                     ngraph::op::PadType::EXPLICIT);
+}
+
+}  // namespace
+
+TEST(TransformationTests, DepthFirstTilingTest1) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    const ngraph::Shape shape{1, 4, 32, 32};
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto conv = makeConvolution(input, makeWeights(), {1, 1}, {1, 1});
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+        auto pool = makeMaxPool(relu);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{pool}, ngraph::ParameterVector{input});
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        // the tensors of the chain take 52 KB, so they are split into two bands
+        m.register_pass<DepthFirstTiling>(32 * 1024);
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto weights = makeWeights();
+        const std::vector<int64_t> mask{1, 1, 0, 1};
+        auto makeBand = [&](int32_t begin, int32_t end, const ngraph::CoordinateDiff& padsBegin, const ngraph::CoordinateDiff& padsEnd) {
+            auto slice = std::make_shared<ngraph::opset1::StridedSlice>(input,
+                ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{4}, {0, 0, begin, 0}),
+                ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{4}, {0, 0, end, 0}),
+                mask, mask);
+            auto conv = makeConvolution(slice, weights, padsBegin, padsEnd);
+            auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+            return makeMaxPool(relu);
+        };
+        auto band0 = makeBand(0, 17, {1, 1}, {0, 1});
+        auto band1 = makeBand(15, 32, {0, 1}, {1, 1});
+        auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{band0, band1}, 2);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{concat}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, DepthFirstTilingTest2) {
+    // the chain fits into the cache
+    std::shared_ptr<ngraph::Function> f(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4, 32, 32});
+        auto conv = makeConvolution(input, makeWeights(), {1, 1}, {1, 1});
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<DepthFirstTiling>(1024 * 1024);
+        m.run_passes(f);
+    }
+
+    ASSERT_EQ(f->get_ops().size(), 5);
+}
+
+TEST(TransformationTests, DepthFirstTilingTest3) {
+    // the constant of Add differs along the height, so the chain ends at the convolution
+    std::shared_ptr<ngraph::Function> f(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4, 32, 32});
+        auto conv = makeConvolution(input, makeWeights(), {1, 1}, {1, 1});
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 32, 1}, {1.f});
+        auto add = std::make_shared<ngraph::opset1::Add>(conv, bias);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<DepthFirstTiling>(1024);
+        m.run_passes(f);
+    }
+
+    const auto ops = f->get_ops();
+    ASSERT_EQ(0, std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& node) {
+        return ngraph::is_type<ngraph::opset1::StridedSlice>(node);
+    }));
+}
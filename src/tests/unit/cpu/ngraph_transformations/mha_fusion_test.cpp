@@ -0,0 +1,159 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph_transformations/mha_fusion.hpp>
+#include <ngraph_transformations/op/mha.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, MHAFusionTest1) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    const ngraph::Shape shape{ 1, 12, 128, 64 };
+    const ngraph::Shape mask_shape{ 1, 1, 1, 128 };
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, mask_shape);
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k, false, true);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 8.f });
+        auto div = std::make_shared<ngraph::opset1::Divide>(qk, scale);
+        auto add = std::make_shared<ngraph::opset1::Add>(div, mask);
+        auto softmax = std::make_shared<ngraph::opset8::Softmax>(add, -1);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ q, k, v, mask });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, mask_shape);
+        auto mha = std::make_shared<MHANode>(q, k, v, mask, 0.125f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mha }, ngraph::ParameterVector{ q, k, v, mask });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MHAFusionTest2) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 4, -1, 32 });
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 4, 32, -1 });
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 4, -1, 16 });
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 3);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ q, k, v });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 4, -1, 32 });
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 4, 32, -1 });
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 4, -1, 16 });
+        auto mha = std::make_shared<MHANode>(q, k, v, 1.f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mha }, ngraph::ParameterVector{ q, k, v });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MHAFusionNotAppliedForSoftmaxNotOverKeys) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    const ngraph::Shape shape{ 2, 4, 16, 16 };
+    auto create_function = [&]() {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 2);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ q, k, v });
+    };
+    {
+        f = create_function();
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MHAFusionNotAppliedForMaskBroadcastingScores) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    const ngraph::Shape shape{ 1, 4, 16, 16 };
+    // the mask has a greater batch than Q, K and V, so the sum has more elements than the scores
+    const ngraph::Shape mask_shape{ 2, 1, 16, 16 };
+    auto create_function = [&]() {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, mask_shape);
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k, false, true);
+        auto add = std::make_shared<ngraph::opset1::Add>(qk, mask);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(add, 3);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ q, k, v, mask });
+    };
+    {
+        f = create_function();
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MHANodeMaskNotBroadcastableToScores) {
+    auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 4, 16, 8 });
+    auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 4, 32, 8 });
+    auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 4, 32, 8 });
+    // scores are [1, 4, 16, 32]
+    auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 32 });
+    ASSERT_NO_THROW(std::make_shared<MHANode>(q, k, v, mask, 1.f, true));
+    auto wrong_mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 16 });
+    ASSERT_THROW(std::make_shared<MHANode>(q, k, v, wrong_mask, 1.f, true), ngraph::NodeValidationFailure);
+    auto broadcasting_mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 32 });
+    ASSERT_THROW(std::make_shared<MHANode>(q, k, v, broadcasting_mask, 1.f, true), ngraph::NodeValidationFailure);
+}